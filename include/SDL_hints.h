@@ -916,6 +916,185 @@ extern "C" {
  */
 #define SDL_HINT_KMSDRM_REQUIRE_DRM_MASTER      "SDL_KMSDRM_REQUIRE_DRM_MASTER"
 
+/**
+ * \brief Determines whether the KMSDRM backend presents frames with atomic
+ *        modesetting commits.
+ *
+ * When enabled and supported by the kernel driver, page flips, cursor plane
+ * updates and CRTC property changes are batched into a single nonblocking
+ * atomic commit per frame. The first commit is validated with a TEST_ONLY
+ * probe, and SDL falls back to the legacy drmModeSetCrtc/drmModePageFlip
+ * path if the driver rejects it.
+ *
+ * This hint must be set before creating a window.
+ *
+ * This variable can be set to the following values:
+ *    "0"       - Always use the legacy modesetting path
+ *    "1"       - Use atomic commits when available (default)
+ */
+#define SDL_HINT_KMSDRM_ATOMIC      "SDL_KMSDRM_ATOMIC"
+
+/**
+ * \brief Determines whether the KMSDRM backend lets the display plane scale
+ *        the application's buffers.
+ *
+ * When enabled, and the atomic path is in use, the application's buffers are
+ * scanned out directly with the primary plane doing the aspect-correct scaling
+ * and rotation, instead of having the GLES blitter thread draw them into a
+ * second full-screen buffer. SDL checks that the plane can do it with a
+ * TEST_ONLY commit when the window surfaces are created, and uses the blitter
+ * otherwise. The blitter is always used with SDL_KMSDRM_HQ_SCALER.
+ *
+ * This hint must be set before creating a window.
+ *
+ * This variable can be set to the following values:
+ *    "0"       - Always use the blitter
+ *    "1"       - Use plane scaling when the hardware supports it (default)
+ */
+#define SDL_HINT_KMSDRM_PLANE_SCALING "SDL_KMSDRM_PLANE_SCALING"
+
+/**
+ * \brief Determines whether the KMSDRM backend paces frames "just in time".
+ *
+ * With vsync on, an application renders right after the previous frame is
+ * queued, so its input is sampled up to a full refresh before the frame is
+ * scanned out. When enabled, SDL_GL_SwapWindow() predicts the next vblanks
+ * from the page flip timestamps, measures how long the application takes
+ * to render a frame, and delays returning so the next frame starts as late
+ * as it safely can. Has no effect with a swap interval of 0, or of -1 where
+ * the KMSDRM backend presents in mailbox mode and never blocks the
+ * application.
+ *
+ * This hint must be set before creating a window.
+ *
+ * This variable can be set to the following values:
+ *    "0"       - Return from SDL_GL_SwapWindow() as soon as possible (default)
+ *    "1"       - Delay SDL_GL_SwapWindow() to cut input latency
+ */
+#define SDL_HINT_KMSDRM_FRAME_PACING "SDL_KMSDRM_FRAME_PACING"
+
+/**
+ * \brief Determines whether the KMSDRM backend enables variable refresh rate.
+ *
+ * When the connector reports that the display supports variable refresh
+ * rate (adaptive sync, FreeSync), SDL enables it on the CRTC so that each
+ * frame is shown as soon as it's presented, instead of on the next fixed
+ * vblank. This removes judder for content running at a rate that doesn't
+ * match the display's, like emulated 50 or 59.73 Hz systems. Displays that
+ * don't support it are driven at a fixed rate as usual.
+ *
+ * This hint must be set before creating a window.
+ *
+ * This variable can be set to the following values:
+ *    "0"       - Always use a fixed refresh rate
+ *    "1"       - Enable variable refresh rate when supported (default)
+ */
+#define SDL_HINT_KMSDRM_VRR "SDL_KMSDRM_VRR"
+
+/**
+ * \brief The frame rate of the content, for the KMSDRM backend to pick the
+ *        display mode that shows it best.
+ *
+ * When set to a rate in Hz, like "59.73" or "50", SDL picks among the modes
+ * with the size it would use anyway the one whose exact refresh rate (from
+ * its pixel clock and timings, not the rounded refresh rate) paces that
+ * content with the smallest error, allowing for each frame to be shown for
+ * a whole number of refreshes.
+ *
+ * This hint can be changed at any time, the display mode is updated on the
+ * next SDL_GL_SwapWindow().
+ *
+ * By default, or when set to "0", the refresh rate is not considered.
+ */
+#define SDL_HINT_KMSDRM_CONTENT_RATE "SDL_KMSDRM_CONTENT_RATE"
+
+/**
+ * \brief A variable controlling whether the KMSDRM blitter caches its
+ *        compiled shaders on disk.
+ *
+ * With GL_OES_get_program_binary, the blitter's linked program is saved
+ * under the SDL pref path ("SDL/kmsdrm"), along with the GL driver strings
+ * and the shader sources it was built from, so later runs with the same
+ * ones skip shader compilation.
+ *
+ * This variable can be set to the following values:
+ *   "0"       - Always compile the shaders, nothing is read or written on disk
+ *   "1"       - Use the shader cache (default)
+ *
+ * This hint must be set before creating a window.
+ */
+#define SDL_HINT_KMSDRM_SHADER_CACHE "SDL_KMSDRM_SHADER_CACHE"
+
+/**
+ * \brief A variable controlling whether the KMSDRM backend allocates
+ *        scanout buffers with explicit format modifiers.
+ *
+ * With atomic modesetting, the primary plane's IN_FORMATS property lists
+ * the tiled or compressed layouts (e.g. AFBC) it can scan out. Allocating
+ * with those instead of the driver's implicit, often linear, layout cuts
+ * the memory bandwidth needed per frame.
+ *
+ * This variable can be set to the following values:
+ *   "0"       - Use the driver's implicit layout
+ *   "1"       - Use format modifiers when the display supports them (default)
+ *
+ * This hint must be set before creating a window.
+ */
+#define SDL_HINT_KMSDRM_MODIFIERS "SDL_KMSDRM_MODIFIERS"
+
+/**
+ * \brief A variable controlling the pixel format of the buffers the KMSDRM
+ *        backend scans out.
+ *
+ * This applies to the blitter's output and to the window's own buffers,
+ * which are scanned out directly when the display plane does the scaling.
+ * Alpha is never used by the display, and the 16-bit format halves the
+ * memory traffic of every frame on panels that can't show more anyway.
+ *
+ * This variable can be set to the following values:
+ *   "ARGB8888" - 32-bit with alpha (default)
+ *   "XRGB8888" - 32-bit without alpha
+ *   "RGB565"   - 16-bit
+ *
+ * This hint must be set before creating a window.
+ */
+#define SDL_HINT_KMSDRM_SCANOUT_FORMAT "SDL_KMSDRM_SCANOUT_FORMAT"
+
+/**
+ * \brief A variable controlling whether the KMSDRM backend synchronizes
+ *        with the GPU through fences instead of waiting for it.
+ *
+ * With EGL_ANDROID_native_fence_sync and EGL_KHR_wait_sync, the blitter's
+ * GPU waits for the application's frame, and the display waits for the
+ * finished frame through the plane's IN_FENCE_FD, so no thread blocks on
+ * rendering.
+ *
+ * This variable can be set to the following values:
+ *   "0"       - Wait for rendering on the CPU
+ *   "1"       - Use fences when the driver supports them (default)
+ *
+ * This hint must be set before creating a window.
+ */
+#define SDL_HINT_KMSDRM_EXPLICIT_SYNC "SDL_KMSDRM_EXPLICIT_SYNC"
+
+/**
+ * \brief A variable controlling whether the KMSDRM backend mirrors a window
+ *        on the other connected displays.
+ *
+ * Each frame is rendered once and scanned out from the same buffer on every
+ * display, in the same atomic commit, with each display's primary plane
+ * scaling it to fit its own mode. Displays that can't do it are left out.
+ * Cloning needs atomic modesetting, and the other displays shouldn't have
+ * windows of their own.
+ *
+ * This variable can be set to the following values:
+ *   "0"       - Only show the window on its own display (default)
+ *   "1"       - Show the window on all connected displays
+ *
+ * This hint must be set before creating a window.
+ */
+#define SDL_HINT_KMSDRM_CLONE "SDL_KMSDRM_CLONE"
+
 /**
   *  \brief  A comma separated list of devices to open as joysticks
   *
@@ -1378,6 +1557,20 @@ extern "C" {
  */
 #define SDL_HINT_SCREENSAVER_INHIBIT_ACTIVITY_NAME "SDL_SCREENSAVER_INHIBIT_ACTIVITY_NAME"
 
+/**
+ *  \brief  A variable controlling when software blits are split across threads
+ *
+ *  Software blits, SDL_ConvertPixels() and SDL_PremultiplyAlpha() covering
+ *  at least this many pixels are split into bands of rows, which run in
+ *  parallel on a pool of worker threads. The pool is started the first time
+ *  it is needed, with one thread less than the number of CPU cores.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Always run on the calling thread
+ *    "N"       - Use the worker threads for jobs of N pixels or more (default: 262144)
+ */
+#define SDL_HINT_SURFACE_THREAD_THRESHOLD "SDL_SURFACE_THREAD_THRESHOLD"
+
 /**
  *  \brief Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as realtime.
  *
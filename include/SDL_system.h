@@ -182,7 +182,233 @@ extern DECLSPEC int SDLCALL SDL_LinuxSetThreadPriority(Sint64 threadID, int prio
  * \since This function is available since SDL 2.0.18.
  */
 extern DECLSPEC int SDLCALL SDL_LinuxSetThreadPriorityAndPolicy(Sint64 threadID, int sdlPriority, int schedPolicy);
- 
+
+/**
+ * Presentation timing of a single frame on the KMSDRM video driver.
+ *
+ * All timestamps are in nanoseconds on the CLOCK_MONOTONIC clock, the one
+ * the kernel uses for page flip events. A timestamp of 0 means it isn't
+ * known for that frame.
+ *
+ * \sa SDL_KMSDRMGetFrameTimings
+ */
+typedef struct SDL_KMSDRMFrameTiming
+{
+    Uint64 swap_ns;         /**< When the application called SDL_GL_SwapWindow() */
+    Uint64 fence_ns;        /**< When the application's rendering was seen to be done */
+    Uint64 submit_ns;       /**< When the frame was committed to KMS */
+    Uint64 target_ns;       /**< The first vblank the frame could make after submission */
+    Uint64 flip_ns;         /**< When the frame actually hit the screen */
+    Uint32 sequence;        /**< Vblank counter at flip time */
+    Uint32 missed_vblanks;  /**< Vblanks between target_ns and flip_ns */
+} SDL_KMSDRMFrameTiming;
+
+/**
+ * Get the presentation timings of the last frames shown by a window on the
+ * KMSDRM video driver.
+ *
+ * The driver keeps the timings of the last 128 frames. They are copied
+ * oldest first, so the last entry is the latest frame that hit the screen.
+ *
+ * Set the SDL_LOG_CATEGORY_VIDEO priority to SDL_LOG_PRIORITY_DEBUG to get
+ * periodic summaries of these timings in the log.
+ *
+ * \param window the window to query
+ * \param timings an array to fill, or NULL to only get the number of frames
+ *                available
+ * \param count the number of elements in `timings`
+ * \returns the number of frames copied (or available), or -1 on error; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMGetFrameTimings(SDL_Window *window, SDL_KMSDRMFrameTiming *timings, int count);
+
+/**
+ * Tell the KMSDRM video driver which parts of a window changed in the
+ * frame about to be presented with SDL_GL_SwapWindow().
+ *
+ * Only the damaged regions are then scaled to the screen, and the display
+ * is told about them. The rectangles are in window pixels, with the origin
+ * at the top left. A `count` of 0 means the frame is identical to the one
+ * on screen: it isn't presented at all, and SDL_GL_SwapWindow() only waits
+ * for the next vblank when vsync is on.
+ *
+ * The damage applies to the next swap only; without it, the whole window is
+ * considered changed.
+ *
+ * \param window the window that is about to be swapped
+ * \param rects the changed regions, or NULL for the whole window
+ * \param count the number of elements in `rects`
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_GL_SwapWindow
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMSetSwapDamage(SDL_Window *window, const SDL_Rect *rects, int count);
+
+/**
+ * An entry of a color lookup table for the KMSDRM display engine.
+ *
+ * Entries are evenly spaced over the input range, and each channel maps to
+ * an output from 0 to 0xFFFF.
+ *
+ * \sa SDL_KMSDRMSetColorPipeline
+ */
+typedef struct SDL_KMSDRMColorLUTEntry
+{
+    Uint16 red;
+    Uint16 green;
+    Uint16 blue;
+    Uint16 reserved;    /**< Unused, set to 0 */
+} SDL_KMSDRMColorLUTEntry;
+
+/**
+ * Get what the color pipeline of the display showing a window can do, on
+ * the KMSDRM video driver.
+ *
+ * Scanned out pixels go through a degamma lookup table, then a 3x3 color
+ * transformation matrix, then a gamma lookup table. Hardware may have any
+ * of these stages, with lookup tables of any size.
+ *
+ * \param window the window to query
+ * \param degamma_size filled with the number of entries of the degamma
+ *                     table, 0 if there's none; may be NULL
+ * \param has_ctm filled with SDL_TRUE if there is a color transformation
+ *                matrix; may be NULL
+ * \param gamma_size filled with the number of entries of the gamma table, 0
+ *                   if there's none; may be NULL
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_KMSDRMSetColorPipeline
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMGetColorPipeline(SDL_Window *window, int *degamma_size, SDL_bool *has_ctm, int *gamma_size);
+
+/**
+ * Set the color pipeline of the display showing a window, on the KMSDRM
+ * video driver.
+ *
+ * This does color correction or tinting in the display engine, at no cost
+ * to the GPU. All stages change together, with the next frame presented.
+ * A NULL stage is bypassed, so passing NULL for all of them restores the
+ * colors untouched.
+ *
+ * The matrix is applied as `out = ctm * in`, with `in` and `out` as (red,
+ * green, blue) column vectors.
+ *
+ * This overrides SDL_SetWindowGammaRamp(), which uses the same hardware.
+ *
+ * \param window the window whose display to change
+ * \param degamma an array of as many entries as SDL_KMSDRMGetColorPipeline()
+ *                reported for the degamma table, or NULL
+ * \param ctm the 3x3 color transformation matrix in row-major order, or
+ *            NULL
+ * \param gamma an array of as many entries as SDL_KMSDRMGetColorPipeline()
+ *              reported for the gamma table, or NULL
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_KMSDRMGetColorPipeline
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMSetColorPipeline(SDL_Window *window, const SDL_KMSDRMColorLUTEntry *degamma, const float *ctm, const SDL_KMSDRMColorLUTEntry *gamma);
+
+/**
+ * A frame shown by a window on the KMSDRM video driver, as a dma-buf.
+ *
+ * This is the buffer that was scanned out, after any scaling or rotation
+ * done by the driver, in the layout the display engine reads. It can be
+ * imported as is by EGL (EGL_EXT_image_dma_buf_import), Vulkan or a video
+ * encoder.
+ *
+ * \sa SDL_KMSDRMAcquireCaptureFrame
+ */
+typedef struct SDL_KMSDRMCaptureFrame
+{
+    int fd;                 /**< dma-buf of the frame, owned by the caller */
+    int width;
+    int height;
+    Uint32 format;          /**< DRM fourcc, DRM_FORMAT_* */
+    Uint64 modifier;        /**< DRM format modifier, DRM_FORMAT_MOD_INVALID if unknown */
+    int num_planes;         /**< Planes of the buffer, all in `fd` */
+    Uint32 offsets[4];      /**< Where each plane starts in the buffer */
+    Uint32 pitches[4];      /**< Bytes per row of each plane */
+    Uint64 flip_ns;         /**< When the frame hit the screen, on CLOCK_MONOTONIC */
+    Uint32 sequence;        /**< Vblank counter at flip time */
+    Uint32 id;              /**< Identifies the frame to SDL_KMSDRMReleaseCaptureFrame() */
+} SDL_KMSDRMCaptureFrame;
+
+/**
+ * Set how many presented frames a window on the KMSDRM video driver keeps
+ * around for capture.
+ *
+ * Retained frames are not drawn into again until they fall out of the
+ * window's ring, or until they're released if they were acquired, so they
+ * can be read by the GPU or a video encoder with no copy. Each one takes a
+ * buffer away from rendering, so holding them for long will stall the
+ * application.
+ *
+ * Frames are only captured with OpenGL ES windows, and a frame is only
+ * retained once it has been shown.
+ *
+ * \param window the window to capture
+ * \param count the number of frames to retain, up to 2, or 0 to stop
+ *              capturing
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_KMSDRMAcquireCaptureFrame
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMSetCaptureFrames(SDL_Window *window, int count);
+
+/**
+ * Get the oldest retained frame of a window on the KMSDRM video driver that
+ * wasn't acquired yet.
+ *
+ * The frame stays untouched until it's given back with
+ * SDL_KMSDRMReleaseCaptureFrame(). Its dma-buf file descriptor belongs to
+ * the caller, who has to close it, and can be kept after the frame is
+ * released; the contents just aren't guaranteed anymore.
+ *
+ * This can be called from any thread.
+ *
+ * \param window the window to capture
+ * \param frame filled with the frame
+ * \returns 1 if a frame was acquired, 0 if there's no new frame, or -1 on
+ *          error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_KMSDRMSetCaptureFrames
+ * \sa SDL_KMSDRMReleaseCaptureFrame
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMAcquireCaptureFrame(SDL_Window *window, SDL_KMSDRMCaptureFrame *frame);
+
+/**
+ * Give a frame from SDL_KMSDRMAcquireCaptureFrame() back to a window on the
+ * KMSDRM video driver, once the GPU or encoder is done reading it.
+ *
+ * This doesn't close the frame's file descriptor.
+ *
+ * \param window the window the frame came from
+ * \param frame the frame to release
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_KMSDRMAcquireCaptureFrame
+ */
+extern DECLSPEC int SDLCALL SDL_KMSDRMReleaseCaptureFrame(SDL_Window *window, const SDL_KMSDRMCaptureFrame *frame);
+
 #endif /* __LINUX__ */
 	
 /* Platform specific functions for iOS */
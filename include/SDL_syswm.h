@@ -211,6 +211,14 @@ struct SDL_SysWMmsg
             MPARAM mp1;                 /**< The first first message parameter */
             MPARAM mp2;                 /**< The second first message parameter */
         } os2;
+#endif
+#if defined(SDL_VIDEO_DRIVER_KMSDRM)
+        struct
+        {
+            Uint32 windowID;            /**< The window whose frame went on screen */
+            Uint32 sequence;            /**< The vblank counter at the page flip */
+            Uint64 flip_ns;             /**< CLOCK_MONOTONIC time of the page flip, in nanoseconds */
+        } kmsdrm;                       /**< A page flip, sent by the event loop for every frame presented */
 #endif
         /* Can't have an empty union */
         int dummy;
@@ -52,6 +52,7 @@
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "video/SDL_blit_threads.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -491,6 +492,8 @@ SDL_Quit(void)
     SDL_TicksQuit();
 #endif
 
+    SDL_BlitThreadsQuit();
+
     SDL_ClearHints();
     SDL_AssertionsQuit();
 
@@ -269,6 +269,24 @@ static void SDL_EVDEV_udev_callback(SDL_UDEV_deviceevent udev_event, int udev_cl
 }
 #endif /* SDL_USE_LIBUDEV */
 
+/* The input device FDs, for video drivers that wait for events with poll() */
+int
+SDL_EVDEV_GetFDs(int *fds, int max_fds)
+{
+    SDL_evdevlist_item *item;
+    int num_fds = 0;
+
+    if (!_this) {
+        return 0;
+    }
+
+    for (item = _this->first; item != NULL && num_fds < max_fds; item = item->next) {
+        fds[num_fds++] = item->fd;
+    }
+
+    return num_fds;
+}
+
 void 
 SDL_EVDEV_Poll(void)
 {
@@ -884,3 +884,10 @@
 #define SDL_GetRectDisplayIndex SDL_GetRectDisplayIndex_REAL
 #define SDL_ResetHint SDL_ResetHint_REAL
 #define SDL_crc16 SDL_crc16_REAL
+#define SDL_KMSDRMGetFrameTimings SDL_KMSDRMGetFrameTimings_REAL
+#define SDL_KMSDRMSetSwapDamage SDL_KMSDRMSetSwapDamage_REAL
+#define SDL_KMSDRMGetColorPipeline SDL_KMSDRMGetColorPipeline_REAL
+#define SDL_KMSDRMSetColorPipeline SDL_KMSDRMSetColorPipeline_REAL
+#define SDL_KMSDRMSetCaptureFrames SDL_KMSDRMSetCaptureFrames_REAL
+#define SDL_KMSDRMAcquireCaptureFrame SDL_KMSDRMAcquireCaptureFrame_REAL
+#define SDL_KMSDRMReleaseCaptureFrame SDL_KMSDRMReleaseCaptureFrame_REAL
@@ -967,3 +967,12 @@ SDL_DYNAPI_PROC(int,SDL_GetPointDisplayIndex,(const SDL_Point *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_GetRectDisplayIndex,(const SDL_Rect *a),(a),return)
 SDL_DYNAPI_PROC(SDL_bool,SDL_ResetHint,(const char *a),(a),return)
 SDL_DYNAPI_PROC(Uint16,SDL_crc16,(Uint16 a, const void *b, size_t c),(a,b,c),return)
+#ifdef __LINUX__
+SDL_DYNAPI_PROC(int,SDL_KMSDRMGetFrameTimings,(SDL_Window *a, SDL_KMSDRMFrameTiming *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMSetSwapDamage,(SDL_Window *a, const SDL_Rect *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMGetColorPipeline,(SDL_Window *a, int *b, SDL_bool *c, int *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMSetColorPipeline,(SDL_Window *a, const SDL_KMSDRMColorLUTEntry *b, const float *c, const SDL_KMSDRMColorLUTEntry *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMSetCaptureFrames,(SDL_Window *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMAcquireCaptureFrame,(SDL_Window *a, SDL_KMSDRMCaptureFrame *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_KMSDRMReleaseCaptureFrame,(SDL_Window *a, const SDL_KMSDRMCaptureFrame *b),(a,b),return)
+#endif
@@ -26,9 +26,30 @@
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
 #include "SDL_blit_slow.h"
+#include "SDL_blit_threads.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+typedef struct
+{
+    SDL_BlitFunc func;
+    const SDL_BlitInfo *info;
+} SDL_SoftBlitJob;
+
+/* Runs a band of rows of an unscaled blit */
+static void
+SDL_SoftBlitBand(void *data, int y, int h)
+{
+    const SDL_SoftBlitJob *job = (const SDL_SoftBlitJob *) data;
+    SDL_BlitInfo info = *job->info;
+
+    info.src += y * info.src_pitch;
+    info.dst += y * info.dst_pitch;
+    info.src_h = h;
+    info.dst_h = h;
+    job->func(&info);
+}
+
 /* The general purpose software blit routine */
 static int SDLCALL
 SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
@@ -84,8 +105,19 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit. Unscaled blits between separate
+           pixels can be split into bands of rows, running in parallel. */
+        if (info->src_w == info->dst_w && info->src_h == info->dst_h &&
+            (info->src >= info->dst + info->dst_h * info->dst_pitch ||
+             info->dst >= info->src + info->src_h * info->src_pitch)) {
+            SDL_SoftBlitJob job;
+
+            job.func = RunBlit;
+            job.info = info;
+            SDL_RunBlitBands(info->dst_w, info->dst_h, SDL_SoftBlitBand, &job);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -155,6 +187,12 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             if (SDL_HasSSE2()) {
                 features |= SDL_CPU_SSE2;
             }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
             if (SDL_HasAltiVec()) {
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
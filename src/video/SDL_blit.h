@@ -33,6 +33,28 @@
 #undef SDL_ARM_NEON_BLITTERS
 #endif
 
+/* Intrinsics blitters. AVX2 is only ever picked at runtime, so unless the
+   whole build targets it, its blitters are compiled for it one function at
+   a time. The NEON ones are for little endian AArch64, 32-bit ARM has
+   pixman's. */
+#ifdef __SSE2__
+#define SDL_BLIT_HAVE_SSE2 1
+#endif
+#if defined(__AVX2__)
+#define SDL_BLIT_HAVE_AVX2 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+      defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define SDL_BLIT_HAVE_AVX2 1
+#endif
+#if SDL_BLIT_HAVE_AVX2 && defined(__GNUC__)
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#else
+#define SDL_TARGETING_AVX2
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define SDL_BLIT_HAVE_NEON 1
+#endif
+
 /* Table to do pixel byte expansion */
 extern Uint8* SDL_expand_byte[9];
 
@@ -58,6 +80,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
+#define SDL_CPU_NEON                0x00000080
 
 typedef struct
 {
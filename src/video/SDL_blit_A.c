@@ -391,6 +391,631 @@ BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo * info)
 
 #endif /* __MMX__ */
 
+/* The SSE2, AVX2 and AArch64 NEON blitters below give exactly the same
+   results as the MMX (x86) or C (ARM) blitters they take over from, the
+   leftover pixels at the end of each row go through scalar versions of the
+   same arithmetic. */
+
+#if SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2
+
+/* One pixel of BlitRGBtoRGBSurfaceAlphaMMX(), amult holds the alpha in the
+   bytes of the color channels */
+static SDL_INLINE Uint32
+BlendRGBtoRGBSurfaceAlphaMMX(Uint32 s, Uint32 d, Uint32 amult, Uint32 dalpha)
+{
+    Uint32 out = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        int sc = (s >> shift) & 0xff;
+        int dc = (d >> shift) & 0xff;
+        int mult = (amult >> shift) & 0xff;
+        /* The product wraps around in 16 bits, as in _mm_mullo_pi16() */
+        out |= ((dc + ((Uint16)((sc - dc) * mult) >> 8)) & 0xff) << shift;
+    }
+    return out | dalpha;
+}
+
+/* One pixel of BlitRGBtoRGBPixelAlphaMMX() */
+static SDL_INLINE Uint32
+BlendRGBtoRGBPixelAlphaMMX(Uint32 s, Uint32 d, Uint32 amask, Uint32 ashift)
+{
+    Uint32 alpha = (s & amask) >> ashift;
+    Uint32 out = 0;
+    Uint32 shift;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == 0xff) {
+        return s;
+    }
+    for (shift = 0; shift < 32; shift += 8) {
+        /* The source's own alpha channel is weighted by 255 */
+        Uint32 salpha = (shift == ashift) ? 0xff : alpha;
+        out |= ((((s >> shift) & 0xff) * salpha >> 8) +
+                (((d >> shift) & 0xff) * (alpha ^ 0xff) >> 8)) << shift;
+    }
+    return out;
+}
+
+#endif /* SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 */
+
+#if SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 || SDL_BLIT_HAVE_NEON
+
+/* One pixel of BlitARGBto565PixelAlpha() */
+static SDL_INLINE Uint16
+BlendARGBto565PixelAlpha(Uint32 s, Uint16 dst)
+{
+    unsigned alpha = s >> 27;
+    Uint32 d = dst;
+
+    if (!alpha) {
+        return dst;
+    } else if (alpha == (SDL_ALPHA_OPAQUE >> 3)) {
+        return (Uint16)((s >> 8 & 0xf800) + (s >> 5 & 0x7e0) + (s >> 3 & 0x1f));
+    }
+    s = ((s & 0xfc00) << 11) + (s >> 8 & 0xf800) + (s >> 3 & 0x1f);
+    d = (d | d << 16) & 0x07e0f81f;
+    d += (s - d) * alpha >> 5;
+    d &= 0x07e0f81f;
+    return (Uint16)(d | d >> 16);
+}
+
+#endif /* SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 || SDL_BLIT_HAVE_NEON */
+
+#if SDL_BLIT_HAVE_SSE2
+
+/* SSE2 has no 32-bit multiply, build it from the 32x32->64 one */
+static SDL_INLINE __m128i
+MulLo32SSE2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha=128 special case */
+static void
+BlitRGBtoRGBSurfaceAlpha128SSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 dalpha = info->dst_fmt->Amask;
+    const __m128i hmask = _mm_set1_epi32(0x00fefefe);
+    const __m128i lmask = _mm_set1_epi32(0x00010101);
+    const __m128i dsta = _mm_set1_epi32(dalpha);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i avg = _mm_srli_epi32(_mm_add_epi32(_mm_and_si128(s, hmask),
+                                                       _mm_and_si128(d, hmask)), 1);
+            avg = _mm_add_epi32(avg, _mm_and_si128(_mm_and_si128(s, d), lmask));
+            _mm_storeu_si128((__m128i *) dstp, _mm_or_si128(avg, dsta));
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            Uint32 s = *srcp++;
+            Uint32 d = *dstp;
+            *dstp++ = ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1)
+                       + (s & d & 0x00010101)) | dalpha;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    SDL_PixelFormat *df = info->dst_fmt;
+    unsigned alpha = info->a;
+
+    if (alpha == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF) {
+        /* only call a128 version when R,G,B occupy lower bits */
+        BlitRGBtoRGBSurfaceAlpha128SSE2(info);
+    } else {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        Uint32 *srcp = (Uint32 *) info->src;
+        int srcskip = info->src_skip >> 2;
+        Uint32 *dstp = (Uint32 *) info->dst;
+        int dstskip = info->dst_skip >> 2;
+        Uint32 dalpha = df->Amask;
+        Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+        Uint32 amult = (alpha * 0x01010101) & chanmask;
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i mm_alpha = _mm_unpacklo_epi8(_mm_set1_epi32(amult), zero);
+        const __m128i dsta = _mm_set1_epi32(dalpha);
+
+        while (height--) {
+            int n;
+            for (n = width; n >= 4; n -= 4) {
+                __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                __m128i dlo = _mm_unpacklo_epi8(d, zero);
+                __m128i dhi = _mm_unpackhi_epi8(d, zero);
+                __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(s, zero), dlo);
+                __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(s, zero), dhi);
+
+                /* (src - dst) * alpha >> 8, added to dst byte-wise */
+                lo = _mm_add_epi8(_mm_srli_epi16(_mm_mullo_epi16(lo, mm_alpha), 8), dlo);
+                hi = _mm_add_epi8(_mm_srli_epi16(_mm_mullo_epi16(hi, mm_alpha), 8), dhi);
+                _mm_storeu_si128((__m128i *) dstp, _mm_or_si128(_mm_packus_epi16(lo, hi), dsta));
+                srcp += 4;
+                dstp += 4;
+            }
+            for (; n > 0; n--) {
+                *dstp = BlendRGBtoRGBSurfaceAlphaMMX(*srcp, *dstp, amult, dalpha);
+                ++srcp;
+                ++dstp;
+            }
+            srcp += srcskip;
+            dstp += dstskip;
+        }
+    }
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    Uint32 amask = sf->Amask;
+    Uint32 ashift = sf->Ashift;
+    Uint64 multmask = (Uint64) 0x00FF << (ashift * 2);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v_ff = _mm_set1_epi16(0xff);
+    const __m128i v_opaque = _mm_set1_epi32(0xff);
+    const __m128i v_amask = _mm_set1_epi32(amask);
+    const __m128i v_ashift = _mm_cvtsi32_si128(ashift);
+    /* 0x00FF in the alpha channel of both pixels of each half */
+    const __m128i v_multmask = _mm_set_epi32((int) (multmask >> 32), (int) multmask,
+                                             (int) (multmask >> 32), (int) multmask);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i alpha = _mm_srl_epi32(_mm_and_si128(s, v_amask), v_ashift);
+            __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+            __m128i opaque = _mm_cmpeq_epi32(alpha, v_opaque);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i a = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));    /* 0A0A per pixel */
+            __m128i alo = _mm_unpacklo_epi32(a, a);
+            __m128i ahi = _mm_unpackhi_epi32(a, a);
+            __m128i lo, hi, out;
+
+            lo = _mm_add_epi16(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_or_si128(alo, v_multmask)), 8),
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_xor_si128(alo, v_ff)), 8));
+            hi = _mm_add_epi16(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_or_si128(ahi, v_multmask)), 8),
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_xor_si128(ahi, v_ff)), 8));
+            out = _mm_packus_epi16(lo, hi);
+
+            /* Left alone where transparent, copied where opaque. Selected
+               with masks rather than branched on, sprite edges mix all
+               three kinds of pixels and would mispredict. */
+            out = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(transparent, opaque), out),
+                               _mm_or_si128(_mm_and_si128(transparent, d), _mm_and_si128(opaque, s)));
+            _mm_storeu_si128((__m128i *) dstp, out);
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendRGBtoRGBPixelAlphaMMX(*srcp, *dstp, amask, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void
+BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v_opaque = _mm_set1_epi32(SDL_ALPHA_OPAQUE >> 3);
+    const __m128i g0rab = _mm_set1_epi32(0x07e0f81f);
+    const __m128i gmask = _mm_set1_epi32(0xfc00);
+    const __m128i rmask = _mm_set1_epi32(0xf800);
+    const __m128i gmask565 = _mm_set1_epi32(0x7e0);
+    const __m128i bmask = _mm_set1_epi32(0x1f);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i alpha = _mm_srli_epi32(s, 27);  /* downscale alpha to 5 bits */
+            __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+            __m128i opaque = _mm_cmpeq_epi32(alpha, v_opaque);
+            __m128i d = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *) dstp), zero);
+            __m128i rb = _mm_add_epi32(_mm_and_si128(_mm_srli_epi32(s, 8), rmask),
+                                       _mm_and_si128(_mm_srli_epi32(s, 3), bmask));
+            __m128i conv = _mm_add_epi32(rb, _mm_and_si128(_mm_srli_epi32(s, 5), gmask565));
+            __m128i sx = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(s, gmask), 11), rb);
+            __m128i dx = _mm_and_si128(_mm_or_si128(d, _mm_slli_epi32(d, 16)), g0rab);
+
+            /* blend all components at once in G0RAB65565 */
+            dx = _mm_add_epi32(dx, _mm_srli_epi32(MulLo32SSE2(_mm_sub_epi32(sx, dx), alpha), 5));
+            dx = _mm_and_si128(dx, g0rab);
+            dx = _mm_or_si128(dx, _mm_srli_epi32(dx, 16));
+
+            /* Left alone where transparent, converted where opaque, as in
+               BlitRGBtoRGBPixelAlphaSSE2() without branching */
+            dx = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(transparent, opaque), dx),
+                              _mm_or_si128(_mm_and_si128(transparent, d), _mm_and_si128(opaque, conv)));
+
+            /* Sign extend the low halves, so the saturating pack keeps them */
+            dx = _mm_srai_epi32(_mm_slli_epi32(dx, 16), 16);
+            _mm_storel_epi64((__m128i *) dstp, _mm_packs_epi32(dx, dx));
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendARGBto565PixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* SDL_BLIT_HAVE_SSE2 */
+
+#if SDL_BLIT_HAVE_AVX2
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void SDL_TARGETING_AVX2
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    Uint32 amask = sf->Amask;
+    Uint32 ashift = sf->Ashift;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v_ff = _mm256_set1_epi16(0xff);
+    const __m256i v_opaque = _mm256_set1_epi32(0xff);
+    const __m256i v_amask = _mm256_set1_epi32(amask);
+    const __m128i v_ashift = _mm_cvtsi32_si128(ashift);
+    const __m256i v_multmask = _mm256_set1_epi64x((Sint64) ((Uint64) 0x00FF << (ashift * 2)));
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 8; n -= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            __m256i alpha = _mm256_srl_epi32(_mm256_and_si256(s, v_amask), v_ashift);
+            __m256i transparent = _mm256_cmpeq_epi32(alpha, zero);
+            __m256i opaque = _mm256_cmpeq_epi32(alpha, v_opaque);
+            /* Same as the SSE2 version, unpacking stays within each
+               128-bit lane and the final pack puts everything back */
+            __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            __m256i a = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 16));
+            __m256i alo = _mm256_unpacklo_epi32(a, a);
+            __m256i ahi = _mm256_unpackhi_epi32(a, a);
+            __m256i lo, hi, out;
+
+            lo = _mm256_add_epi16(
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_or_si256(alo, v_multmask)), 8),
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_xor_si256(alo, v_ff)), 8));
+            hi = _mm256_add_epi16(
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_or_si256(ahi, v_multmask)), 8),
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_xor_si256(ahi, v_ff)), 8));
+            out = _mm256_packus_epi16(lo, hi);
+
+            out = _mm256_blendv_epi8(out, d, transparent);
+            out = _mm256_blendv_epi8(out, s, opaque);
+            _mm256_storeu_si256((__m256i *) dstp, out);
+            srcp += 8;
+            dstp += 8;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendRGBtoRGBPixelAlphaMMX(*srcp, *dstp, amask, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void SDL_TARGETING_AVX2
+BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v_opaque = _mm256_set1_epi32(SDL_ALPHA_OPAQUE >> 3);
+    const __m256i g0rab = _mm256_set1_epi32(0x07e0f81f);
+    const __m256i gmask = _mm256_set1_epi32(0xfc00);
+    const __m256i rmask = _mm256_set1_epi32(0xf800);
+    const __m256i gmask565 = _mm256_set1_epi32(0x7e0);
+    const __m256i bmask = _mm256_set1_epi32(0x1f);
+    const __m256i lowmask = _mm256_set1_epi32(0xffff);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 8; n -= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            __m256i alpha = _mm256_srli_epi32(s, 27);   /* downscale alpha to 5 bits */
+            __m256i transparent = _mm256_cmpeq_epi32(alpha, zero);
+            __m256i opaque = _mm256_cmpeq_epi32(alpha, v_opaque);
+            __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) dstp));
+            __m256i rb = _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(s, 8), rmask),
+                                          _mm256_and_si256(_mm256_srli_epi32(s, 3), bmask));
+            __m256i conv = _mm256_add_epi32(rb, _mm256_and_si256(_mm256_srli_epi32(s, 5), gmask565));
+            __m256i sx = _mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(s, gmask), 11), rb);
+            __m256i dx = _mm256_and_si256(_mm256_or_si256(d, _mm256_slli_epi32(d, 16)), g0rab);
+
+            /* blend all components at once in G0RAB65565 */
+            dx = _mm256_add_epi32(dx, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(sx, dx), alpha), 5));
+            dx = _mm256_and_si256(dx, g0rab);
+            dx = _mm256_and_si256(_mm256_or_si256(dx, _mm256_srli_epi32(dx, 16)), lowmask);
+
+            dx = _mm256_blendv_epi8(dx, d, transparent);
+            dx = _mm256_blendv_epi8(dx, conv, opaque);
+
+            /* The pack works per 128-bit lane, gather both halves */
+            dx = _mm256_permute4x64_epi64(_mm256_packus_epi32(dx, dx), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128((__m128i *) dstp, _mm256_castsi256_si128(dx));
+            srcp += 8;
+            dstp += 8;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendARGBto565PixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* SDL_BLIT_HAVE_AVX2 */
+
+#if SDL_BLIT_HAVE_NEON
+
+/* One pixel of BlitRGBtoRGBSurfaceAlpha() */
+static SDL_INLINE Uint32
+BlendRGBtoRGBSurfaceAlpha(Uint32 s, Uint32 d, unsigned alpha)
+{
+    Uint32 s1 = s & 0xff00ff;
+    Uint32 d1 = d & 0xff00ff;
+
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s &= 0xff00;
+    d &= 0xff00;
+    d = (d + ((s - d) * alpha >> 8)) & 0xff00;
+    return d1 | d | 0xff000000;
+}
+
+/* One pixel of BlitRGBtoRGBPixelAlpha() */
+static SDL_INLINE Uint32
+BlendRGBtoRGBPixelAlpha(Uint32 s, Uint32 d)
+{
+    Uint32 alpha = s >> 24;
+    Uint32 dalpha = d >> 24;
+    Uint32 s1, d1;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == SDL_ALPHA_OPAQUE) {
+        return s;
+    }
+    s1 = s & 0xff00ff;
+    d1 = d & 0xff00ff;
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s &= 0xff00;
+    d &= 0xff00;
+    d = (d + ((s - d) * alpha >> 8)) & 0xff00;
+    dalpha = alpha + (dalpha * (alpha ^ 0xFF) >> 8);
+    return d1 | d | (dalpha << 24);
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    unsigned alpha = info->a;
+    const uint32x4_t rbmask = vdupq_n_u32(0xff00ff);
+    const uint32x4_t gmask = vdupq_n_u32(0xff00);
+    const uint32x4_t amask = vdupq_n_u32(0xff000000);
+    const uint32x4_t hmask = vdupq_n_u32(0x00fefefe);
+    const uint32x4_t lmask = vdupq_n_u32(0x00010101);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            uint32x4_t s = vld1q_u32(srcp);
+            uint32x4_t d = vld1q_u32(dstp);
+            uint32x4_t out;
+
+            if (alpha == 128) {
+                out = vshrq_n_u32(vaddq_u32(vandq_u32(s, hmask), vandq_u32(d, hmask)), 1);
+                out = vaddq_u32(out, vandq_u32(vandq_u32(s, d), lmask));
+            } else {
+                uint32x4_t s1 = vandq_u32(s, rbmask);
+                uint32x4_t d1 = vandq_u32(d, rbmask);
+                uint32x4_t sg = vandq_u32(s, gmask);
+                uint32x4_t dg = vandq_u32(d, gmask);
+
+                d1 = vaddq_u32(d1, vshrq_n_u32(vmulq_n_u32(vsubq_u32(s1, d1), alpha), 8));
+                dg = vaddq_u32(dg, vshrq_n_u32(vmulq_n_u32(vsubq_u32(sg, dg), alpha), 8));
+                out = vorrq_u32(vandq_u32(d1, rbmask), vandq_u32(dg, gmask));
+            }
+            vst1q_u32(dstp, vorrq_u32(out, amask));
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            Uint32 s = *srcp++;
+            Uint32 d = *dstp;
+            if (alpha == 128) {
+                *dstp++ = ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1)
+                           + (s & d & 0x00010101)) | 0xff000000;
+            } else {
+                *dstp++ = BlendRGBtoRGBSurfaceAlpha(s, d, alpha);
+            }
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const uint32x4_t rbmask = vdupq_n_u32(0xff00ff);
+    const uint32x4_t gmask = vdupq_n_u32(0xff00);
+    const uint32x4_t v_ff = vdupq_n_u32(0xff);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            uint32x4_t s = vld1q_u32(srcp);
+            uint32x4_t alpha = vshrq_n_u32(s, 24);
+            uint32x4_t transparent = vceqzq_u32(alpha);
+            uint32x4_t opaque = vceqq_u32(alpha, v_ff);
+
+            if (vminvq_u32(opaque)) {
+                vst1q_u32(dstp, s);
+            } else if (!vminvq_u32(transparent)) {
+                uint32x4_t d = vld1q_u32(dstp);
+                uint32x4_t s1 = vandq_u32(s, rbmask);
+                uint32x4_t d1 = vandq_u32(d, rbmask);
+                uint32x4_t sg = vandq_u32(s, gmask);
+                uint32x4_t dg = vandq_u32(d, gmask);
+                uint32x4_t da = vshrq_n_u32(d, 24);
+                uint32x4_t out;
+
+                d1 = vaddq_u32(d1, vshrq_n_u32(vmulq_u32(vsubq_u32(s1, d1), alpha), 8));
+                dg = vaddq_u32(dg, vshrq_n_u32(vmulq_u32(vsubq_u32(sg, dg), alpha), 8));
+                da = vaddq_u32(alpha, vshrq_n_u32(vmulq_u32(da, veorq_u32(alpha, v_ff)), 8));
+                out = vorrq_u32(vandq_u32(d1, rbmask), vandq_u32(dg, gmask));
+                out = vorrq_u32(out, vshlq_n_u32(da, 24));
+
+                out = vbslq_u32(transparent, d, out);
+                out = vbslq_u32(opaque, s, out);
+                vst1q_u32(dstp, out);
+            }
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendRGBtoRGBPixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void
+BlitARGBto565PixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const uint32x4_t v_opaque = vdupq_n_u32(SDL_ALPHA_OPAQUE >> 3);
+    const uint32x4_t g0rab = vdupq_n_u32(0x07e0f81f);
+    const uint32x4_t gmask = vdupq_n_u32(0xfc00);
+    const uint32x4_t rmask = vdupq_n_u32(0xf800);
+    const uint32x4_t gmask565 = vdupq_n_u32(0x7e0);
+    const uint32x4_t bmask = vdupq_n_u32(0x1f);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4) {
+            uint32x4_t s = vld1q_u32(srcp);
+            uint32x4_t alpha = vshrq_n_u32(s, 27);  /* downscale alpha to 5 bits */
+            uint32x4_t transparent = vceqzq_u32(alpha);
+
+            if (!vminvq_u32(transparent)) {
+                uint32x4_t d = vmovl_u16(vld1_u16(dstp));
+                uint32x4_t opaque = vceqq_u32(alpha, v_opaque);
+                uint32x4_t rb = vaddq_u32(vandq_u32(vshrq_n_u32(s, 8), rmask),
+                                          vandq_u32(vshrq_n_u32(s, 3), bmask));
+                uint32x4_t conv = vaddq_u32(rb, vandq_u32(vshrq_n_u32(s, 5), gmask565));
+                uint32x4_t sx = vaddq_u32(vshlq_n_u32(vandq_u32(s, gmask), 11), rb);
+                uint32x4_t dx = vandq_u32(vorrq_u32(d, vshlq_n_u32(d, 16)), g0rab);
+
+                /* blend all components at once in G0RAB65565 */
+                dx = vaddq_u32(dx, vshrq_n_u32(vmulq_u32(vsubq_u32(sx, dx), alpha), 5));
+                dx = vandq_u32(dx, g0rab);
+                dx = vorrq_u32(dx, vshrq_n_u32(dx, 16));
+
+                dx = vbslq_u32(transparent, d, dx);
+                dx = vbslq_u32(opaque, conv, dx);
+                vst1_u16(dstp, vmovn_u32(dx));
+            }
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; n--) {
+            *dstp = BlendARGBto565PixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* SDL_BLIT_HAVE_NEON */
+
 #if SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
 
@@ -1425,8 +2050,21 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     && sf->Gmask == 0xff00
                     && ((sf->Rmask == 0xff && df->Rmask == 0x1f)
                         || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
-                if (df->Gmask == 0x7e0)
+                if (df->Gmask == 0x7e0) {
+#if SDL_BLIT_HAVE_AVX2
+                    if (SDL_HasAVX2())
+                        return BlitARGBto565PixelAlphaAVX2;
+#endif
+#if SDL_BLIT_HAVE_SSE2
+                    if (SDL_HasSSE2())
+                        return BlitARGBto565PixelAlphaSSE2;
+#endif
+#if SDL_BLIT_HAVE_NEON
+                    if (SDL_HasNEON())
+                        return BlitARGBto565PixelAlphaNEON;
+#endif
                     return BlitARGBto565PixelAlpha;
+                }
                 else if (df->Gmask == 0x3e0)
                     return BlitARGBto555PixelAlpha;
             }
@@ -1436,6 +2074,21 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2
+                if (sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0
+                    && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+#if SDL_BLIT_HAVE_AVX2
+                    if (SDL_HasAVX2())
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if SDL_BLIT_HAVE_SSE2
+                    if (SDL_HasSSE2())
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+#endif
+                }
+#endif /* SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 */
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
@@ -1452,6 +2105,10 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 }
 #endif /* __MMX__ || __3dNOW__ */
                 if (sf->Amask == 0xff000000) {
+#if SDL_BLIT_HAVE_NEON
+                    if (SDL_HasNEON())
+                        return BlitRGBtoRGBPixelAlphaNEON;
+#endif
 #if SDL_ARM_NEON_BLITTERS
                     if (SDL_HasNEON())
                         return BlitRGBtoRGBPixelAlphaARMNEON;
@@ -1513,6 +2170,12 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if SDL_BLIT_HAVE_SSE2
+                    if (sf->Rshift % 8 == 0
+                        && sf->Gshift % 8 == 0
+                        && sf->Bshift % 8 == 0 && SDL_HasSSE2())
+                        return BlitRGBtoRGBSurfaceAlphaSSE2;
+#endif
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
@@ -1520,6 +2183,10 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                         return BlitRGBtoRGBSurfaceAlphaMMX;
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#if SDL_BLIT_HAVE_NEON
+                        if (SDL_HasNEON())
+                            return BlitRGBtoRGBSurfaceAlphaNEON;
+#endif
                         return BlitRGBtoRGBSurfaceAlpha;
                     }
                 }
@@ -28,10 +28,10 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "SDL_blit_auto_simd.h"
 
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -40,15 +40,14 @@ static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             *dst = *src;
             posx += incx;
             ++dst;
@@ -114,7 +113,6 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -123,15 +121,14 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -207,7 +204,6 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -216,15 +212,14 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -321,7 +316,6 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -330,15 +324,14 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -392,7 +385,6 @@ static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -401,15 +393,14 @@ static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             pixel = (B << 16) | (G << 8) | R;
@@ -478,7 +469,6 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -487,15 +477,14 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -571,7 +560,6 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -580,15 +568,14 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -685,7 +672,6 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -694,15 +680,14 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -756,7 +741,6 @@ static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     const Uint32 A = 0xFF;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -765,15 +749,14 @@ static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel |= (A << 24);
             *dst = pixel;
@@ -843,7 +826,6 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -852,15 +834,14 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -942,7 +923,6 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = (flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 0xFF;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -951,15 +931,14 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -1058,7 +1037,6 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1067,15 +1045,14 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1131,7 +1108,6 @@ static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1140,15 +1116,14 @@ static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (R << 16) | (G << 8) | B;
@@ -1217,7 +1192,6 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1226,15 +1200,14 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1310,7 +1283,6 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1319,15 +1291,14 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -1424,7 +1395,6 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1433,15 +1403,14 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1493,7 +1462,6 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 
 static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
 {
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1502,15 +1470,14 @@ static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             *dst = *src;
             posx += incx;
             ++dst;
@@ -1576,7 +1543,6 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1585,15 +1551,14 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1669,7 +1634,6 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1678,15 +1642,14 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -1783,7 +1746,6 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1792,15 +1754,14 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1855,7 +1816,6 @@ static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = 0xFF;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1864,15 +1824,14 @@ static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
@@ -1943,7 +1902,6 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -1952,15 +1910,14 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -2042,7 +1999,6 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = (flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 0xFF;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2051,15 +2007,14 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2158,7 +2113,6 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2167,15 +2121,14 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -2230,7 +2183,6 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2239,15 +2191,14 @@ static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel &= 0xFFFFFF;
             *dst = pixel;
@@ -2323,7 +2274,6 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2332,15 +2282,14 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2424,7 +2373,6 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2433,15 +2381,14 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2539,7 +2486,6 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2548,15 +2494,14 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2613,7 +2558,6 @@ static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2622,15 +2566,14 @@ static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             pixel = (B << 16) | (G << 8) | R;
@@ -2707,7 +2650,6 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2716,15 +2658,14 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2808,7 +2749,6 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2817,15 +2757,14 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2923,7 +2862,6 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -2932,15 +2870,14 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2995,7 +2932,6 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 
 static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3004,15 +2940,14 @@ static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             *dst = *src;
             posx += incx;
             ++dst;
@@ -3088,7 +3023,6 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3097,15 +3031,14 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -3196,7 +3129,6 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3205,15 +3137,14 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -3316,7 +3247,6 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3325,15 +3255,14 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -3391,7 +3320,6 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3400,15 +3328,14 @@ static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel >>= 8;
             *dst = pixel;
@@ -3484,7 +3411,6 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3493,15 +3419,14 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3585,7 +3510,6 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3594,15 +3518,14 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -3700,7 +3623,6 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3709,15 +3631,14 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3774,7 +3695,6 @@ static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3783,15 +3703,14 @@ static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             pixel = (B << 16) | (G << 8) | R;
@@ -3868,7 +3787,6 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3877,15 +3795,14 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3969,7 +3886,6 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -3978,15 +3894,14 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -4084,7 +3999,6 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4093,15 +4007,14 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4157,7 +4070,6 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4166,15 +4078,14 @@ static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel = (pixel >> 8) | (pixel << 24);
             *dst = pixel;
@@ -4252,7 +4163,6 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4261,15 +4171,14 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4360,7 +4269,6 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4369,15 +4277,14 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -4480,7 +4387,6 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4489,15 +4395,14 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4556,7 +4461,6 @@ static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4565,15 +4469,14 @@ static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (R << 16) | (G << 8) | B;
@@ -4650,7 +4553,6 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4659,15 +4561,14 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -4751,7 +4652,6 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4760,15 +4660,14 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -4866,7 +4765,6 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4875,15 +4773,14 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -4939,7 +4836,6 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -4948,15 +4844,14 @@ static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel &= 0xFFFFFF;
             *dst = pixel;
@@ -5032,7 +4927,6 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5041,15 +4935,14 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5133,7 +5026,6 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5142,15 +5034,14 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -5248,7 +5139,6 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5257,15 +5147,14 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5322,7 +5211,6 @@ static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5331,15 +5219,14 @@ static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
@@ -5418,7 +5305,6 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5427,15 +5313,14 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5526,7 +5411,6 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5535,15 +5419,14 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -5646,7 +5529,6 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5655,15 +5537,14 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5722,7 +5603,6 @@ static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5731,15 +5611,14 @@ static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             pixel = (R << 16) | (G << 8) | B;
@@ -5816,7 +5695,6 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5825,15 +5703,14 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -5917,7 +5794,6 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -5926,15 +5802,14 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -6032,7 +5907,6 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6041,15 +5915,14 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6105,7 +5978,6 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6114,15 +5986,14 @@ static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             pixel >>= 8;
             *dst = pixel;
@@ -6198,7 +6069,6 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6207,15 +6077,14 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6299,7 +6168,6 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6308,15 +6176,14 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -6414,7 +6281,6 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6423,15 +6289,14 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6488,7 +6353,6 @@ static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6497,15 +6361,14 @@ static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
@@ -6584,7 +6447,6 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6593,15 +6455,14 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6692,7 +6553,6 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6701,15 +6561,14 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -6812,7 +6671,6 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 
@@ -6821,15 +6679,14 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     posy = incy / 2;
 
     while (info->dst_h--) {
+        Uint32 *srcrow = (Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
         Uint32 *src = 0;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            src = srcrow + (posx >> 16);
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6884,7 +6741,2977 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_BLIT_HAVE_AVX2
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_AVX2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+#endif /* SDL_BLIT_HAVE_AVX2 */
+
+#if SDL_BLIT_HAVE_SSE2
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_SSE2(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+#endif /* SDL_BLIT_HAVE_SSE2 */
+
+#if SDL_BLIT_HAVE_NEON
+
+static void SDL_Blit_RGB888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, -1 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 16, 8, 0, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 24, 16, 8, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 0, 8, 16, 24 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 0, 8, 16, -1 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const SDL_Blit8888Format srcfmt = { 8, 16, 24, 0 };
+    const SDL_Blit8888Format dstfmt = { 16, 8, 0, 24 };
+    SDL_Blit8888_NEON(info, &srcfmt, &dstfmt, 1, 1, 1);
+}
+
+#endif /* SDL_BLIT_HAVE_NEON */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if SDL_BLIT_HAVE_AVX2
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if SDL_BLIT_HAVE_SSE2
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if SDL_BLIT_HAVE_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
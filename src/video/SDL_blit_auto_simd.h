@@ -0,0 +1,486 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_blit_auto_simd_h_
+#define SDL_blit_auto_simd_h_
+
+#include "SDL_blit.h"
+
+/* Kernels for the _SSE2, _AVX2 and _NEON blitters of SDL_blit_auto.c.
+ *
+ * sdlgenblit.pl emits one function per format pair and variant, which
+ * passes the channel layout of both formats to the kernels below; once
+ * inlined, the compiler folds them into constants. Pixels are split into
+ * one 16-bit lane per channel, so the math is done 8 (SSE2, NEON) or 16
+ * (AVX2) pixels at a time, with exactly the same results as the C
+ * blitters: x / 255 is computed exactly, and premultiplying by an opaque
+ * alpha is a no-op.
+ *
+ * SDL_COPY_MUL is left to the C blitters, its intermediate sums don't fit
+ * in 16 bits.
+ */
+
+/* Channel shifts of a 32-bit format, -1 when it has no alpha */
+typedef struct
+{
+    int r, g, b, a;
+} SDL_Blit8888Format;
+
+#if SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 || SDL_BLIT_HAVE_NEON
+
+/* Walks the rows of a blit, handing the kernel `step` pixels at a time.
+   Partial runs at the end of a row go through the kernel in a scratch
+   buffer. Scaled blits step through the source with the same 16.16 fixed
+   point as the C blitters, from a row pointer computed once per row; the
+   kernel gathers its pixels from there. */
+#define SDL_BLIT8888_WALK(step, kernel)                                     \
+    Uint32 sbuf[step], dbuf[step];                                          \
+    Uint32 posy = 0, posx = 0;                                              \
+    int incy = 0, incx = 0;                                                 \
+    int i;                                                                  \
+                                                                            \
+    SDL_zero(sbuf);                                                         \
+    SDL_zero(dbuf);                                                         \
+    if (scale) {                                                            \
+        incy = (info->src_h << 16) / info->dst_h;                           \
+        incx = (info->src_w << 16) / info->dst_w;                           \
+        posy = incy / 2;                                                    \
+    }                                                                       \
+    while (info->dst_h--) {                                                 \
+        const Uint32 *src = (const Uint32 *)info->src;                      \
+        Uint32 *dst = (Uint32 *)info->dst;                                  \
+        int n = info->dst_w;                                                \
+                                                                            \
+        if (scale) {                                                        \
+            src = (const Uint32 *)(info->src + (posy >> 16) * info->src_pitch); \
+            posx = incx / 2;                                                \
+        }                                                                   \
+        for (; n >= step; n -= step) {                                      \
+            if (scale) {                                                    \
+                kernel(src, dst, info, sf, df, modulate, blend, SDL_TRUE, posx, incx); \
+                posx += step * incx;                                        \
+            } else {                                                        \
+                kernel(src, dst, info, sf, df, modulate, blend, SDL_FALSE, 0, 0); \
+                src += step;                                                \
+            }                                                               \
+            dst += step;                                                    \
+        }                                                                   \
+        if (n > 0) {                                                        \
+            if (scale) {                                                    \
+                for (i = 0; i < n; ++i) {                                   \
+                    sbuf[i] = src[posx >> 16];                              \
+                    posx += incx;                                           \
+                }                                                           \
+            } else {                                                        \
+                SDL_memcpy(sbuf, src, n * 4);                               \
+            }                                                               \
+            SDL_memcpy(dbuf, dst, n * 4);                                   \
+            kernel(sbuf, dbuf, info, sf, df, modulate, blend, SDL_FALSE, 0, 0); \
+            SDL_memcpy(dst, dbuf, n * 4);                                   \
+        }                                                                   \
+        if (scale) {                                                        \
+            posy += incy;                                                   \
+        } else {                                                            \
+            info->src += info->src_pitch;                                   \
+        }                                                                   \
+        info->dst += info->dst_pitch;                                       \
+    }
+
+#endif /* SDL_BLIT_HAVE_SSE2 || SDL_BLIT_HAVE_AVX2 || SDL_BLIT_HAVE_NEON */
+
+#if SDL_BLIT_HAVE_SSE2
+
+/* Exact x / 255 for any 16-bit x */
+SDL_FORCE_INLINE __m128i
+SDL_Blit8888_Div255_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+/* One channel of 8 pixels, in 16-bit lanes */
+SDL_FORCE_INLINE __m128i
+SDL_Blit8888_Unpack_SSE2(__m128i lo, __m128i hi, int shift)
+{
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(lo, count), mask),
+                           _mm_and_si128(_mm_srl_epi32(hi, count), mask));
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_Pack_SSE2(__m128i c, int shift, __m128i *lo, __m128i *hi)
+{
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m128i zero = _mm_setzero_si128();
+    *lo = _mm_or_si128(*lo, _mm_sll_epi32(_mm_unpacklo_epi16(c, zero), count));
+    *hi = _mm_or_si128(*hi, _mm_sll_epi32(_mm_unpackhi_epi16(c, zero), count));
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_Pixels_SSE2(const Uint32 *src, Uint32 *dst, const SDL_BlitInfo *info,
+                         const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                         int modulate, int blend, int gather, Uint32 posx, int incx)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi16(255);
+    __m128i slo, shi, R, G, B, A;
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+
+    if (gather) {
+        slo = _mm_setr_epi32(src[posx >> 16], src[(posx + incx) >> 16],
+                             src[(posx + 2 * incx) >> 16], src[(posx + 3 * incx) >> 16]);
+        posx += 4 * incx;
+        shi = _mm_setr_epi32(src[posx >> 16], src[(posx + incx) >> 16],
+                             src[(posx + 2 * incx) >> 16], src[(posx + 3 * incx) >> 16]);
+    } else {
+        slo = _mm_loadu_si128((const __m128i *)src);
+        shi = _mm_loadu_si128((const __m128i *)(src + 4));
+    }
+    R = SDL_Blit8888_Unpack_SSE2(slo, shi, sf->r);
+    G = SDL_Blit8888_Unpack_SSE2(slo, shi, sf->g);
+    B = SDL_Blit8888_Unpack_SSE2(slo, shi, sf->b);
+
+    if (sf->a >= 0) {
+        A = SDL_Blit8888_Unpack_SSE2(slo, shi, sf->a);
+    } else if (modulate && (flags & SDL_COPY_MODULATE_ALPHA)) {
+        A = _mm_set1_epi16(info->a);
+    } else {
+        A = v255;
+    }
+
+    if (modulate) {
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            R = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(R, _mm_set1_epi16(info->r)));
+            G = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(G, _mm_set1_epi16(info->g)));
+            B = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(B, _mm_set1_epi16(info->b)));
+        }
+        if (sf->a >= 0 && (blend || df->a >= 0) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            A = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(A, _mm_set1_epi16(info->a)));
+        }
+    }
+
+    if (blend) {
+        const __m128i dlo = _mm_loadu_si128((const __m128i *)dst);
+        const __m128i dhi = _mm_loadu_si128((const __m128i *)(dst + 4));
+        __m128i dR = SDL_Blit8888_Unpack_SSE2(dlo, dhi, df->r);
+        __m128i dG = SDL_Blit8888_Unpack_SSE2(dlo, dhi, df->g);
+        __m128i dB = SDL_Blit8888_Unpack_SSE2(dlo, dhi, df->b);
+        __m128i dA = (df->a >= 0) ? SDL_Blit8888_Unpack_SSE2(dlo, dhi, df->a) : v255;
+        __m128i inv;
+
+        if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+            R = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(R, A));
+            G = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(G, A));
+            B = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(B, A));
+        }
+        switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+        case SDL_COPY_BLEND:
+            inv = _mm_sub_epi16(v255, A);
+            dR = _mm_add_epi16(R, SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(inv, dR)));
+            dG = _mm_add_epi16(G, SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(inv, dG)));
+            dB = _mm_add_epi16(B, SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(inv, dB)));
+            dA = _mm_add_epi16(A, SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(inv, dA)));
+            break;
+        case SDL_COPY_ADD:
+            dR = _mm_min_epi16(_mm_add_epi16(R, dR), v255);
+            dG = _mm_min_epi16(_mm_add_epi16(G, dG), v255);
+            dB = _mm_min_epi16(_mm_add_epi16(B, dB), v255);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(R, dR));
+            dG = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(G, dG));
+            dB = SDL_Blit8888_Div255_SSE2(_mm_mullo_epi16(B, dB));
+            break;
+        }
+        R = dR;
+        G = dG;
+        B = dB;
+        A = dA;
+    }
+
+    SDL_Blit8888_Pack_SSE2(R, df->r, &lo, &hi);
+    SDL_Blit8888_Pack_SSE2(G, df->g, &lo, &hi);
+    SDL_Blit8888_Pack_SSE2(B, df->b, &lo, &hi);
+    if (df->a >= 0) {
+        SDL_Blit8888_Pack_SSE2(A, df->a, &lo, &hi);
+    }
+    _mm_storeu_si128((__m128i *)dst, lo);
+    _mm_storeu_si128((__m128i *)(dst + 4), hi);
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_SSE2(SDL_BlitInfo *info, const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                  int modulate, int blend, int scale)
+{
+    SDL_BLIT8888_WALK(8, SDL_Blit8888_Pixels_SSE2)
+}
+
+#endif /* SDL_BLIT_HAVE_SSE2 */
+
+#if SDL_BLIT_HAVE_AVX2
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_Blit8888_Div255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+/* The pack works within each 128-bit lane, which shuffles the pixels
+   around, but Pack_AVX2() puts them back in order */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_Blit8888_Unpack_AVX2(__m256i lo, __m256i hi, int shift)
+{
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    return _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(lo, count), mask),
+                              _mm256_and_si256(_mm256_srl_epi32(hi, count), mask));
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+SDL_Blit8888_Pack_AVX2(__m256i c, int shift, __m256i *lo, __m256i *hi)
+{
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m256i zero = _mm256_setzero_si256();
+    *lo = _mm256_or_si256(*lo, _mm256_sll_epi32(_mm256_unpacklo_epi16(c, zero), count));
+    *hi = _mm256_or_si256(*hi, _mm256_sll_epi32(_mm256_unpackhi_epi16(c, zero), count));
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+SDL_Blit8888_Pixels_AVX2(const Uint32 *src, Uint32 *dst, const SDL_BlitInfo *info,
+                         const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                         int modulate, int blend, int gather, Uint32 posx, int incx)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi16(255);
+    __m256i slo, shi, R, G, B, A;
+    __m256i lo = _mm256_setzero_si256();
+    __m256i hi = _mm256_setzero_si256();
+
+    if (gather) {
+        const __m256i steps = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(incx));
+        const __m256i pos = _mm256_add_epi32(_mm256_set1_epi32((int)posx), steps);
+        slo = _mm256_i32gather_epi32((const int *)src, _mm256_srli_epi32(pos, 16), 4);
+        shi = _mm256_i32gather_epi32((const int *)src,
+                                     _mm256_srli_epi32(_mm256_add_epi32(pos, _mm256_set1_epi32(8 * incx)), 16), 4);
+    } else {
+        slo = _mm256_loadu_si256((const __m256i *)src);
+        shi = _mm256_loadu_si256((const __m256i *)(src + 8));
+    }
+    R = SDL_Blit8888_Unpack_AVX2(slo, shi, sf->r);
+    G = SDL_Blit8888_Unpack_AVX2(slo, shi, sf->g);
+    B = SDL_Blit8888_Unpack_AVX2(slo, shi, sf->b);
+
+    if (sf->a >= 0) {
+        A = SDL_Blit8888_Unpack_AVX2(slo, shi, sf->a);
+    } else if (modulate && (flags & SDL_COPY_MODULATE_ALPHA)) {
+        A = _mm256_set1_epi16(info->a);
+    } else {
+        A = v255;
+    }
+
+    if (modulate) {
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            R = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(R, _mm256_set1_epi16(info->r)));
+            G = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(G, _mm256_set1_epi16(info->g)));
+            B = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(B, _mm256_set1_epi16(info->b)));
+        }
+        if (sf->a >= 0 && (blend || df->a >= 0) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            A = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(A, _mm256_set1_epi16(info->a)));
+        }
+    }
+
+    if (blend) {
+        const __m256i dlo = _mm256_loadu_si256((const __m256i *)dst);
+        const __m256i dhi = _mm256_loadu_si256((const __m256i *)(dst + 8));
+        __m256i dR = SDL_Blit8888_Unpack_AVX2(dlo, dhi, df->r);
+        __m256i dG = SDL_Blit8888_Unpack_AVX2(dlo, dhi, df->g);
+        __m256i dB = SDL_Blit8888_Unpack_AVX2(dlo, dhi, df->b);
+        __m256i dA = (df->a >= 0) ? SDL_Blit8888_Unpack_AVX2(dlo, dhi, df->a) : v255;
+        __m256i inv;
+
+        if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+            R = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(R, A));
+            G = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(G, A));
+            B = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(B, A));
+        }
+        switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+        case SDL_COPY_BLEND:
+            inv = _mm256_sub_epi16(v255, A);
+            dR = _mm256_add_epi16(R, SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(inv, dR)));
+            dG = _mm256_add_epi16(G, SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(inv, dG)));
+            dB = _mm256_add_epi16(B, SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(inv, dB)));
+            dA = _mm256_add_epi16(A, SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(inv, dA)));
+            break;
+        case SDL_COPY_ADD:
+            dR = _mm256_min_epi16(_mm256_add_epi16(R, dR), v255);
+            dG = _mm256_min_epi16(_mm256_add_epi16(G, dG), v255);
+            dB = _mm256_min_epi16(_mm256_add_epi16(B, dB), v255);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(R, dR));
+            dG = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(G, dG));
+            dB = SDL_Blit8888_Div255_AVX2(_mm256_mullo_epi16(B, dB));
+            break;
+        }
+        R = dR;
+        G = dG;
+        B = dB;
+        A = dA;
+    }
+
+    SDL_Blit8888_Pack_AVX2(R, df->r, &lo, &hi);
+    SDL_Blit8888_Pack_AVX2(G, df->g, &lo, &hi);
+    SDL_Blit8888_Pack_AVX2(B, df->b, &lo, &hi);
+    if (df->a >= 0) {
+        SDL_Blit8888_Pack_AVX2(A, df->a, &lo, &hi);
+    }
+    _mm256_storeu_si256((__m256i *)dst, lo);
+    _mm256_storeu_si256((__m256i *)(dst + 8), hi);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+SDL_Blit8888_AVX2(SDL_BlitInfo *info, const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                  int modulate, int blend, int scale)
+{
+    SDL_BLIT8888_WALK(16, SDL_Blit8888_Pixels_AVX2)
+}
+
+#endif /* SDL_BLIT_HAVE_AVX2 */
+
+#if SDL_BLIT_HAVE_NEON
+
+/* Exact x / 255 for x up to 255 * 255 */
+SDL_FORCE_INLINE uint16x8_t
+SDL_Blit8888_Div255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+/* vld4 splits the pixels into their bytes, on a little endian CPU the
+   byte of a channel is its shift / 8 */
+SDL_FORCE_INLINE void
+SDL_Blit8888_Pixels_NEON(const Uint32 *src, Uint32 *dst, const SDL_BlitInfo *info,
+                         const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                         int modulate, int blend, int gather, Uint32 posx, int incx)
+{
+    const int flags = info->flags;
+    const uint16x8_t v255 = vdupq_n_u16(255);
+    uint8x8x4_t s, out;
+    uint16x8_t R, G, B, A;
+
+    if (gather) {
+        Uint32 pixels[8];
+        int i;
+
+        for (i = 0; i < 8; ++i) {
+            pixels[i] = src[posx >> 16];
+            posx += incx;
+        }
+        s = vld4_u8((const uint8_t *)pixels);
+    } else {
+        s = vld4_u8((const uint8_t *)src);
+    }
+    R = vmovl_u8(s.val[sf->r >> 3]);
+    G = vmovl_u8(s.val[sf->g >> 3]);
+    B = vmovl_u8(s.val[sf->b >> 3]);
+
+    if (sf->a >= 0) {
+        A = vmovl_u8(s.val[sf->a >> 3]);
+    } else if (modulate && (flags & SDL_COPY_MODULATE_ALPHA)) {
+        A = vdupq_n_u16(info->a);
+    } else {
+        A = v255;
+    }
+
+    if (modulate) {
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            R = SDL_Blit8888_Div255_NEON(vmulq_n_u16(R, info->r));
+            G = SDL_Blit8888_Div255_NEON(vmulq_n_u16(G, info->g));
+            B = SDL_Blit8888_Div255_NEON(vmulq_n_u16(B, info->b));
+        }
+        if (sf->a >= 0 && (blend || df->a >= 0) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            A = SDL_Blit8888_Div255_NEON(vmulq_n_u16(A, info->a));
+        }
+    }
+
+    if (blend) {
+        const uint8x8x4_t d = vld4_u8((const uint8_t *)dst);
+        uint16x8_t dR = vmovl_u8(d.val[df->r >> 3]);
+        uint16x8_t dG = vmovl_u8(d.val[df->g >> 3]);
+        uint16x8_t dB = vmovl_u8(d.val[df->b >> 3]);
+        uint16x8_t dA = (df->a >= 0) ? vmovl_u8(d.val[df->a >> 3]) : v255;
+        uint16x8_t inv;
+
+        if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+            R = SDL_Blit8888_Div255_NEON(vmulq_u16(R, A));
+            G = SDL_Blit8888_Div255_NEON(vmulq_u16(G, A));
+            B = SDL_Blit8888_Div255_NEON(vmulq_u16(B, A));
+        }
+        switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+        case SDL_COPY_BLEND:
+            inv = vsubq_u16(v255, A);
+            dR = vaddq_u16(R, SDL_Blit8888_Div255_NEON(vmulq_u16(inv, dR)));
+            dG = vaddq_u16(G, SDL_Blit8888_Div255_NEON(vmulq_u16(inv, dG)));
+            dB = vaddq_u16(B, SDL_Blit8888_Div255_NEON(vmulq_u16(inv, dB)));
+            dA = vaddq_u16(A, SDL_Blit8888_Div255_NEON(vmulq_u16(inv, dA)));
+            break;
+        case SDL_COPY_ADD:
+            dR = vminq_u16(vaddq_u16(R, dR), v255);
+            dG = vminq_u16(vaddq_u16(G, dG), v255);
+            dB = vminq_u16(vaddq_u16(B, dB), v255);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_Blit8888_Div255_NEON(vmulq_u16(R, dR));
+            dG = SDL_Blit8888_Div255_NEON(vmulq_u16(G, dG));
+            dB = SDL_Blit8888_Div255_NEON(vmulq_u16(B, dB));
+            break;
+        }
+        R = dR;
+        G = dG;
+        B = dB;
+        A = dA;
+    }
+
+    /* Formats without alpha leave their unused byte at 0 */
+    out.val[0] = out.val[1] = out.val[2] = out.val[3] = vdup_n_u8(0);
+    out.val[df->r >> 3] = vmovn_u16(R);
+    out.val[df->g >> 3] = vmovn_u16(G);
+    out.val[df->b >> 3] = vmovn_u16(B);
+    if (df->a >= 0) {
+        out.val[df->a >> 3] = vmovn_u16(A);
+    }
+    vst4_u8((uint8_t *)dst, out);
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_NEON(SDL_BlitInfo *info, const SDL_Blit8888Format *sf, const SDL_Blit8888Format *df,
+                  int modulate, int blend, int scale)
+{
+    SDL_BLIT8888_WALK(8, SDL_Blit8888_Pixels_NEON)
+}
+
+#endif /* SDL_BLIT_HAVE_NEON */
+
+#endif /* SDL_blit_auto_simd_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,224 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
+#include "SDL_blit_threads.h"
+#include "../thread/SDL_systhread.h"
+
+/* Past this the blits are bound by memory bandwidth anyway */
+#define SDL_BLIT_MAX_THREADS    16
+
+/* Several bands per thread, so the threads that finish first pick up the
+   slack of the others */
+#define SDL_BLIT_BANDS_PER_THREAD   4
+
+/* Default for SDL_HINT_SURFACE_THREAD_THRESHOLD */
+#define SDL_BLIT_DEFAULT_THRESHOLD  (512 * 512)
+
+#if !SDL_THREADS_DISABLED
+
+typedef struct
+{
+    SDL_bool initialized;
+    SDL_bool started;
+    SDL_bool quit;
+    SDL_atomic_t threshold;
+    SDL_mutex *lock;            /* Held by the thread submitting a job */
+    SDL_sem *work;              /* Posted once per worker woken for a job */
+    SDL_sem *done;              /* Posted when the job is finished */
+    SDL_Thread *threads[SDL_BLIT_MAX_THREADS];
+    int num_threads;
+
+    /* The current job */
+    SDL_BlitBandFunc func;
+    void *data;
+    int height;
+    int band_h;
+    int num_bands;
+    SDL_atomic_t next_band;
+    SDL_atomic_t pending;       /* Bands left to run, plus the woken workers */
+} SDL_BlitThreadPool;
+
+static SDL_BlitThreadPool pool;
+
+static void SDLCALL
+SDL_BlitThresholdChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_AtomicSet(&pool.threshold, (hint && *hint) ? SDL_atoi(hint) : SDL_BLIT_DEFAULT_THRESHOLD);
+}
+
+static void
+SDL_LeaveBlitJob(void)
+{
+    if (SDL_AtomicAdd(&pool.pending, -1) == 1) {
+        SDL_SemPost(pool.done);
+    }
+}
+
+static void
+SDL_RunPendingBands(void)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&pool.next_band, 1)) < pool.num_bands) {
+        const int y = band * pool.band_h;
+        pool.func(pool.data, y, SDL_min(pool.band_h, pool.height - y));
+        SDL_LeaveBlitJob();
+    }
+}
+
+static int SDLCALL
+SDL_BlitWorker(void *unused)
+{
+    for (;;) {
+        SDL_SemWait(pool.work);
+        if (pool.quit) {
+            break;
+        }
+        SDL_RunPendingBands();
+        SDL_LeaveBlitJob();
+    }
+    return 0;
+}
+
+/* Sets up the pool, the worker threads are only started by the first job
+   that is large enough to need them */
+static SDL_bool
+SDL_InitBlitThreads(void)
+{
+    if (!pool.initialized) {
+        static SDL_SpinLock init_lock;
+
+        SDL_AtomicLock(&init_lock);
+        if (!pool.initialized) {
+            pool.lock = SDL_CreateMutex();
+            pool.work = SDL_CreateSemaphore(0);
+            pool.done = SDL_CreateSemaphore(0);
+            if (pool.lock && pool.work && pool.done) {
+                SDL_AddHintCallback(SDL_HINT_SURFACE_THREAD_THRESHOLD, SDL_BlitThresholdChanged, NULL);
+                SDL_MemoryBarrierRelease();
+                pool.initialized = SDL_TRUE;
+            } else {
+                SDL_DestroySemaphore(pool.done);
+                SDL_DestroySemaphore(pool.work);
+                SDL_DestroyMutex(pool.lock);
+                pool.lock = NULL;
+                pool.work = NULL;
+                pool.done = NULL;
+            }
+        }
+        SDL_AtomicUnlock(&init_lock);
+    }
+    SDL_MemoryBarrierAcquire();
+    return pool.initialized;
+}
+
+static void
+SDL_StartBlitThreads(void)
+{
+    const int count = SDL_min(SDL_GetCPUCount() - 1, SDL_BLIT_MAX_THREADS);
+    int i;
+
+    pool.started = SDL_TRUE;
+    for (i = 0; i < count; ++i) {
+        pool.threads[i] = SDL_CreateThreadInternal(SDL_BlitWorker, "SDLBlit", 0, NULL);
+        if (!pool.threads[i]) {
+            break;
+        }
+        ++pool.num_threads;
+    }
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
+void
+SDL_RunBlitBands(int width, int height, SDL_BlitBandFunc func, void *data)
+{
+#if !SDL_THREADS_DISABLED
+    if (height > 1 && SDL_InitBlitThreads()) {
+        const int threshold = SDL_AtomicGet(&pool.threshold);
+
+        /* If another thread is using the pool, this job runs on its own */
+        if (threshold > 0 && (Sint64)width * height >= threshold &&
+            SDL_TryLockMutex(pool.lock) == 0) {
+            if (!pool.started) {
+                SDL_StartBlitThreads();
+            }
+            if (pool.num_threads > 0) {
+                const int bands = SDL_min(height, (pool.num_threads + 1) * SDL_BLIT_BANDS_PER_THREAD);
+                int workers, i;
+
+                pool.func = func;
+                pool.data = data;
+                pool.height = height;
+                pool.band_h = (height + bands - 1) / bands;
+                pool.num_bands = (height + pool.band_h - 1) / pool.band_h;
+                workers = SDL_min(pool.num_threads, pool.num_bands - 1);
+                SDL_AtomicSet(&pool.next_band, 0);
+                SDL_AtomicSet(&pool.pending, pool.num_bands + workers);
+                for (i = 0; i < workers; ++i) {
+                    SDL_SemPost(pool.work);
+                }
+
+                /* Work alongside the workers, then wait for the last band */
+                SDL_RunPendingBands();
+                SDL_SemWait(pool.done);
+
+                SDL_UnlockMutex(pool.lock);
+                return;
+            }
+            SDL_UnlockMutex(pool.lock);
+        }
+    }
+#endif
+    func(data, 0, height);
+}
+
+void
+SDL_BlitThreadsQuit(void)
+{
+#if !SDL_THREADS_DISABLED
+    int i;
+
+    if (!pool.initialized) {
+        return;
+    }
+
+    SDL_DelHintCallback(SDL_HINT_SURFACE_THREAD_THRESHOLD, SDL_BlitThresholdChanged, NULL);
+
+    pool.quit = SDL_TRUE;
+    for (i = 0; i < pool.num_threads; ++i) {
+        SDL_SemPost(pool.work);
+    }
+    for (i = 0; i < pool.num_threads; ++i) {
+        SDL_WaitThread(pool.threads[i], NULL);
+    }
+    SDL_DestroySemaphore(pool.done);
+    SDL_DestroySemaphore(pool.work);
+    SDL_DestroyMutex(pool.lock);
+    SDL_zero(pool);
+#endif
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
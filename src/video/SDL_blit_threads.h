@@ -0,0 +1,41 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_blit_threads_h_
+#define SDL_blit_threads_h_
+
+#include "../SDL_internal.h"
+
+/* Processes the rows [y, y + h) of a job */
+typedef void (*SDL_BlitBandFunc)(void *data, int y, int h);
+
+/* Runs func over the rows [0, height) of a width x height job. Jobs of at
+   least SDL_HINT_SURFACE_THREAD_THRESHOLD pixels are split into bands of
+   rows that run in parallel on a pool of worker threads, the others run
+   on the calling thread in a single call. */
+extern void SDL_RunBlitBands(int width, int height, SDL_BlitBandFunc func, void *data);
+
+/* Stops the worker threads */
+extern void SDL_BlitThreadsQuit(void);
+
+#endif /* SDL_blit_threads_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
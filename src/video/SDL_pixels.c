@@ -730,6 +730,8 @@ SDL_SetPaletteColors(SDL_Palette * palette, const SDL_Color * colors,
     return status;
 }
 
+static void SDL_FreeInversePalette(const SDL_Palette *pal);
+
 void
 SDL_FreePalette(SDL_Palette * palette)
 {
@@ -740,6 +742,7 @@ SDL_FreePalette(SDL_Palette * palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_FreeInversePalette(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -773,10 +776,10 @@ SDL_DitherColors(SDL_Color * colors, int bpp)
 }
 
 /*
- * Match an RGB value to a particular palette index
+ * Match an RGB value to a particular palette index, by a linear search
  */
-Uint8
-SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static Uint8
+SDL_FindColorLinear(const SDL_Color * colors, int ncolors, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     /* Do colorspace distance matching */
     unsigned int smallest;
@@ -786,11 +789,11 @@ SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     Uint8 pixel = 0;
 
     smallest = ~0;
-    for (i = 0; i < pal->ncolors; ++i) {
-        rd = pal->colors[i].r - r;
-        gd = pal->colors[i].g - g;
-        bd = pal->colors[i].b - b;
-        ad = pal->colors[i].a - a;
+    for (i = 0; i < ncolors; ++i) {
+        rd = colors[i].r - r;
+        gd = colors[i].g - g;
+        bd = colors[i].b - b;
+        ad = colors[i].a - a;
         distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
         if (distance < smallest) {
             pixel = i;
@@ -803,6 +806,219 @@ SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     return (pixel);
 }
 
+/*
+ * Inverse palettes, to speed up color matching on large palettes
+ *
+ * The RGB space is split into a 32x32x32 cube. The first time an opaque
+ * color falls into a cell, the palette entries that can be the closest
+ * match for some color of the cell are listed: those whose distance to the
+ * cell is at most the smallest of the farthest distances of each entry to
+ * the cell. Further lookups only check that list, usually one to a few
+ * entries, with the same result as the linear search.
+ *
+ * Inverse palettes are cached by palette and palette version, so changes
+ * must go through SDL_SetPaletteColors() like they do for blit maps.
+ */
+#define SDL_INVERSE_PALETTE_MIN_COLORS  32
+#define SDL_INVERSE_PALETTE_CACHE_SIZE  4
+
+typedef struct
+{
+    const SDL_Palette *palette;
+    Uint32 version;
+    int ncolors;
+    SDL_Color colors[256];
+    Uint32 cells[32 * 32 * 32];     /* Candidate list offset + 1 << 8 | count - 1, 0 if not listed yet */
+    Uint8 *candidates;
+    int candidates_used;
+    int candidates_size;
+} SDL_InversePalette;
+
+static SDL_SpinLock SDL_inverse_palette_lock;
+static SDL_InversePalette *SDL_inverse_palettes[SDL_INVERSE_PALETTE_CACHE_SIZE];
+static int SDL_inverse_palette_next;
+
+static void
+SDL_InitInversePalette(SDL_InversePalette *inverse, const SDL_Palette *pal)
+{
+    inverse->palette = pal;
+    inverse->version = pal->version;
+    inverse->ncolors = pal->ncolors;
+    SDL_memcpy(inverse->colors, pal->colors, pal->ncolors * sizeof(SDL_Color));
+    SDL_zeroa(inverse->cells);
+    inverse->candidates_used = 0;
+}
+
+/* Called with SDL_inverse_palette_lock held */
+static SDL_InversePalette *
+SDL_GetInversePalette(const SDL_Palette *pal)
+{
+    SDL_InversePalette *inverse;
+    int i;
+
+    for (i = 0; i < SDL_INVERSE_PALETTE_CACHE_SIZE; ++i) {
+        inverse = SDL_inverse_palettes[i];
+        if (inverse && inverse->palette == pal) {
+            if (inverse->version != pal->version || inverse->ncolors != pal->ncolors) {
+                SDL_InitInversePalette(inverse, pal);
+            }
+            return inverse;
+        }
+    }
+
+    /* Replace the oldest entry */
+    i = SDL_inverse_palette_next;
+    SDL_inverse_palette_next = (i + 1) % SDL_INVERSE_PALETTE_CACHE_SIZE;
+    inverse = SDL_inverse_palettes[i];
+    if (!inverse) {
+        inverse = (SDL_InversePalette *) SDL_calloc(1, sizeof(*inverse));
+        if (!inverse) {
+            return NULL;
+        }
+        SDL_inverse_palettes[i] = inverse;
+    }
+    SDL_InitInversePalette(inverse, pal);
+    return inverse;
+}
+
+static void
+SDL_FreeInversePalette(const SDL_Palette *pal)
+{
+    int i;
+
+    SDL_AtomicLock(&SDL_inverse_palette_lock);
+    for (i = 0; i < SDL_INVERSE_PALETTE_CACHE_SIZE; ++i) {
+        SDL_InversePalette *inverse = SDL_inverse_palettes[i];
+        if (inverse && inverse->palette == pal) {
+            SDL_free(inverse->candidates);
+            SDL_free(inverse);
+            SDL_inverse_palettes[i] = NULL;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_inverse_palette_lock);
+}
+
+/* Squared distances from a color component to the closest and farthest
+   points of the [lo, lo + 7] span of a cell */
+#define SDL_CELL_DISTANCES(c, lo, closest, farthest)    \
+    do {                                                \
+        int d0 = (c) - (lo);                            \
+        int d1 = (c) - ((lo) + 7);                      \
+        closest += (d0 < 0) ? d0 * d0 : (d1 > 0) ? d1 * d1 : 0; \
+        farthest += SDL_max(d0 * d0, d1 * d1);          \
+    } while (0)
+
+/* Lists the candidates of a cell, returns SDL_FALSE if out of memory */
+static SDL_bool
+SDL_ListCellCandidates(SDL_InversePalette *inverse, int cell)
+{
+    const int r = (cell >> 10) << 3;
+    const int g = ((cell >> 5) & 31) << 3;
+    const int b = (cell & 31) << 3;
+    unsigned int nearest[256];
+    unsigned int smallest = ~0;
+    int count = 0;
+    int i;
+
+    if (inverse->candidates_size - inverse->candidates_used < inverse->ncolors) {
+        const int size = SDL_max(inverse->candidates_size * 2, 4096);
+        Uint8 *candidates = (Uint8 *) SDL_realloc(inverse->candidates, size);
+        if (!candidates) {
+            return SDL_FALSE;
+        }
+        inverse->candidates = candidates;
+        inverse->candidates_size = size;
+    }
+
+    for (i = 0; i < inverse->ncolors; ++i) {
+        const int ad = inverse->colors[i].a - SDL_ALPHA_OPAQUE;
+        unsigned int closest = ad * ad;
+        unsigned int farthest = ad * ad;
+
+        SDL_CELL_DISTANCES(inverse->colors[i].r, r, closest, farthest);
+        SDL_CELL_DISTANCES(inverse->colors[i].g, g, closest, farthest);
+        SDL_CELL_DISTANCES(inverse->colors[i].b, b, closest, farthest);
+        nearest[i] = closest;
+        if (farthest < smallest) {
+            smallest = farthest;
+        }
+    }
+    for (i = 0; i < inverse->ncolors; ++i) {
+        if (nearest[i] <= smallest) {
+            inverse->candidates[inverse->candidates_used + count++] = (Uint8) i;
+        }
+    }
+    inverse->cells[cell] = ((Uint32)(inverse->candidates_used + 1) << 8) | (count - 1);
+    inverse->candidates_used += count;
+    return SDL_TRUE;
+}
+
+#undef SDL_CELL_DISTANCES
+
+/* Matches an opaque color, returns -1 if out of memory */
+static int
+SDL_FindColorInverse(SDL_InversePalette *inverse, Uint8 r, Uint8 g, Uint8 b)
+{
+    const int cell = ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+    const Uint8 *candidates;
+    unsigned int smallest;
+    unsigned int distance;
+    int rd, gd, bd, ad;
+    int i, count;
+    int pixel = 0;
+
+    if (!inverse->cells[cell] && !SDL_ListCellCandidates(inverse, cell)) {
+        return -1;
+    }
+    candidates = inverse->candidates + (inverse->cells[cell] >> 8) - 1;
+    count = (inverse->cells[cell] & 0xFF) + 1;
+    if (count == 1) {
+        return candidates[0];
+    }
+
+    smallest = ~0;
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &inverse->colors[candidates[i]];
+        rd = color->r - r;
+        gd = color->g - g;
+        bd = color->b - b;
+        ad = color->a - SDL_ALPHA_OPAQUE;
+        distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixel = candidates[i];
+            if (distance == 0) {
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+/*
+ * Match an RGB value to a particular palette index
+ */
+Uint8
+SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    if (a == SDL_ALPHA_OPAQUE &&
+        pal->ncolors >= SDL_INVERSE_PALETTE_MIN_COLORS && pal->ncolors <= 256) {
+        SDL_InversePalette *inverse;
+        int pixel = -1;
+
+        SDL_AtomicLock(&SDL_inverse_palette_lock);
+        inverse = SDL_GetInversePalette(pal);
+        if (inverse) {
+            pixel = SDL_FindColorInverse(inverse, r, g, b);
+        }
+        SDL_AtomicUnlock(&SDL_inverse_palette_lock);
+        if (pixel >= 0) {
+            return (Uint8) pixel;
+        }
+    }
+    return SDL_FindColorLinear(pal->colors, pal->ncolors, r, g, b, a);
+}
+
 /* Tell whether palette is opaque, and if it has an alpha_channel */
 void
 SDL_DetectPalette(SDL_Palette *pal, SDL_bool *is_opaque, SDL_bool *has_alpha_channel)
@@ -23,6 +23,7 @@
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
+#include "SDL_blit_threads.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
@@ -1441,6 +1442,31 @@ SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
     return SDL_TRUE;
 }
 
+/* A block of pixels, processed in bands of rows by SDL_RunBlitBands() */
+typedef struct
+{
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *dst;
+    int dst_pitch;
+    int width;
+} SDL_PixelBlock;
+
+/* Copies a band of rows, the block width is in bytes */
+static void
+SDL_CopyPixelsBand(void *data, int y, int h)
+{
+    const SDL_PixelBlock *block = (const SDL_PixelBlock *) data;
+    const Uint8 *src = block->src + y * block->src_pitch;
+    Uint8 *dst = block->dst + y * block->dst_pitch;
+
+    while (h--) {
+        SDL_memcpy(dst, src, block->width);
+        src += block->src_pitch;
+        dst += block->dst_pitch;
+    }
+}
+
 /*
  * Copy a block of pixels of one format to another format
  */
@@ -1484,14 +1510,14 @@ int SDL_ConvertPixels(int width, int height,
 
     /* Fast path for same format copy */
     if (src_format == dst_format) {
-        int i;
-        const int bpp = SDL_BYTESPERPIXEL(src_format);
-        width *= bpp;
-        for (i = height; i--;) {
-            SDL_memcpy(dst, src, width);
-            src = (const Uint8*)src + src_pitch;
-            dst = (Uint8*)dst + dst_pitch;
-        }
+        SDL_PixelBlock block;
+
+        block.src = (const Uint8 *) src;
+        block.src_pitch = src_pitch;
+        block.dst = (Uint8 *) dst;
+        block.dst_pitch = dst_pitch;
+        block.width = width * SDL_BYTESPERPIXEL(src_format);
+        SDL_RunBlitBands(width, height, SDL_CopyPixelsBand, &block);
         return 0;
     }
 
@@ -1518,6 +1544,42 @@ int SDL_ConvertPixels(int width, int height,
     return ret;
 }
 
+/* Premultiplies a band of rows of ARGB8888 pixels */
+static void
+SDL_PremultiplyAlphaBand(void *data, int y, int h)
+{
+    const SDL_PixelBlock *block = (const SDL_PixelBlock *) data;
+    const Uint8 *src = block->src + y * block->src_pitch;
+    Uint8 *dst = block->dst + y * block->dst_pitch;
+    int c;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (h--) {
+        const Uint32 *src_px = (const Uint32 *)src;
+        Uint32 *dst_px = (Uint32 *)dst;
+        for (c = block->width; c; --c) {
+            /* Component bytes extraction. */
+            srcpixel = *src_px++;
+            RGBA_FROM_ARGB8888(srcpixel, srcR, srcG, srcB, srcA);
+
+            /* Alpha pre-multiplication of each component. */
+            dstA = srcA;
+            dstR = (srcA * srcR) / 255;
+            dstG = (srcA * srcG) / 255;
+            dstB = (srcA * srcB) / 255;
+
+            /* ARGB8888 pixel recomposition. */
+            ARGB8888_FROM_RGBA(dstpixel, dstR, dstG, dstB, dstA);
+            *dst_px++ = dstpixel;
+        }
+        src += block->src_pitch;
+        dst += block->dst_pitch;
+    }
+}
+
 /*
  * Premultiply the alpha on a block of pixels
  *
@@ -1531,11 +1593,7 @@ int SDL_PremultiplyAlpha(int width, int height,
                          Uint32 src_format, const void * src, int src_pitch,
                          Uint32 dst_format, void * dst, int dst_pitch)
 {
-    int c;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    SDL_PixelBlock block;
 
     if (!src) {
         return SDL_InvalidParamError("src");
@@ -1556,27 +1614,12 @@ int SDL_PremultiplyAlpha(int width, int height,
         return SDL_InvalidParamError("dst_format");
     }
 
-    while (height--) {
-        const Uint32 *src_px = (const Uint32 *)src;
-        Uint32 *dst_px = (Uint32 *)dst;
-        for (c = width; c; --c) {
-            /* Component bytes extraction. */
-            srcpixel = *src_px++;
-            RGBA_FROM_ARGB8888(srcpixel, srcR, srcG, srcB, srcA);
-
-            /* Alpha pre-multiplication of each component. */
-            dstA = srcA;
-            dstR = (srcA * srcR) / 255;
-            dstG = (srcA * srcG) / 255;
-            dstB = (srcA * srcB) / 255;
-
-            /* ARGB8888 pixel recomposition. */
-            ARGB8888_FROM_RGBA(dstpixel, dstR, dstG, dstB, dstA);
-            *dst_px++ = dstpixel;
-        }
-        src = (const Uint8 *)src + src_pitch;
-        dst = (Uint8 *)dst + dst_pitch;
-    }
+    block.src = (const Uint8 *) src;
+    block.src_pitch = src_pitch;
+    block.dst = (Uint8 *) dst;
+    block.dst_pitch = dst_pitch;
+    block.width = width;
+    SDL_RunBlitBands(width, height, SDL_PremultiplyAlphaBand, &block);
     return 0;
 }
 
@@ -27,6 +27,7 @@
 #include "SDL_shape.h"
 #include "SDL_thread.h"
 #include "SDL_metal.h"
+#include "SDL_system.h"
 
 #include "SDL_vulkan_internal.h"
 
@@ -337,6 +338,17 @@ struct SDL_VideoDevice
     /* Tell window that app enabled drag'n'drop events */
     void (*AcceptDragAndDrop)(SDL_Window * window, SDL_bool accept);
 
+#ifdef __LINUX__
+    /* KMSDRM extensions, see SDL_system.h */
+    int (*KMSDRM_GetFrameTimings) (_THIS, SDL_Window * window, SDL_KMSDRMFrameTiming * timings, int count);
+    int (*KMSDRM_SetSwapDamage) (_THIS, SDL_Window * window, const SDL_Rect * rects, int count);
+    int (*KMSDRM_GetColorPipeline) (_THIS, SDL_Window * window, int *degamma_size, SDL_bool *has_ctm, int *gamma_size);
+    int (*KMSDRM_SetColorPipeline) (_THIS, SDL_Window * window, const SDL_KMSDRMColorLUTEntry *degamma, const float *ctm, const SDL_KMSDRMColorLUTEntry *gamma);
+    int (*KMSDRM_SetCaptureFrames) (_THIS, SDL_Window * window, int count);
+    int (*KMSDRM_AcquireCaptureFrame) (_THIS, SDL_Window * window, SDL_KMSDRMCaptureFrame * frame);
+    int (*KMSDRM_ReleaseCaptureFrame) (_THIS, SDL_Window * window, const SDL_KMSDRMCaptureFrame * frame);
+#endif
+
     /* * * */
     /* Data common to all drivers */
     SDL_threadID thread;
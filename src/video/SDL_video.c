@@ -2618,6 +2618,11 @@ SDL_CreateWindowFramebuffer(SDL_Window * window)
             attempt_texture_framebuffer = SDL_FALSE;
         }
         #endif
+        #if SDL_VIDEO_DRIVER_KMSDRM /* Dumb buffers avoid the texture upload, and work without a GPU. Set the hint to "1" to scale with the GPU instead. */
+        else if ((_this->CreateWindowFramebuffer != NULL) && (SDL_strcmp(_this->name, "KMSDRM") == 0) && !hint) {
+            attempt_texture_framebuffer = SDL_FALSE;
+        }
+        #endif
         #if defined(__EMSCRIPTEN__)
         else {
             attempt_texture_framebuffer = SDL_FALSE;
@@ -4848,4 +4853,95 @@ void SDL_Metal_GetDrawableSize(SDL_Window * window, int *w, int *h)
     }
 }
 
+#ifdef __LINUX__
+int
+SDL_KMSDRMGetFrameTimings(SDL_Window * window, SDL_KMSDRMFrameTiming *timings, int count)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    if (!_this->KMSDRM_GetFrameTimings) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_GetFrameTimings(_this, window, timings, count);
+}
+
+int
+SDL_KMSDRMSetSwapDamage(SDL_Window * window, const SDL_Rect *rects, int count)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (rects && count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    if (!_this->KMSDRM_SetSwapDamage) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_SetSwapDamage(_this, window, rects, count);
+}
+
+int
+SDL_KMSDRMGetColorPipeline(SDL_Window * window, int *degamma_size, SDL_bool *has_ctm, int *gamma_size)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!_this->KMSDRM_GetColorPipeline) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_GetColorPipeline(_this, window, degamma_size, has_ctm, gamma_size);
+}
+
+int
+SDL_KMSDRMSetColorPipeline(SDL_Window * window, const SDL_KMSDRMColorLUTEntry *degamma, const float *ctm, const SDL_KMSDRMColorLUTEntry *gamma)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!_this->KMSDRM_SetColorPipeline) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_SetColorPipeline(_this, window, degamma, ctm, gamma);
+}
+
+int
+SDL_KMSDRMSetCaptureFrames(SDL_Window * window, int count)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!_this->KMSDRM_SetCaptureFrames) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_SetCaptureFrames(_this, window, count);
+}
+
+int
+SDL_KMSDRMAcquireCaptureFrame(SDL_Window * window, SDL_KMSDRMCaptureFrame * frame)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!frame) {
+        return SDL_InvalidParamError("frame");
+    }
+    if (!_this->KMSDRM_AcquireCaptureFrame) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_AcquireCaptureFrame(_this, window, frame);
+}
+
+int
+SDL_KMSDRMReleaseCaptureFrame(SDL_Window * window, const SDL_KMSDRMCaptureFrame * frame)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!frame) {
+        return SDL_InvalidParamError("frame");
+    }
+    if (!_this->KMSDRM_ReleaseCaptureFrame) {
+        return SDL_Unsupported();
+    }
+    return _this->KMSDRM_ReleaseCaptureFrame(_this, window, frame);
+}
+#endif
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,1245 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_KMSDRM
+
+#include "SDL_log.h"
+#include "SDL_hints.h"
+#include "SDL_timer.h"
+
+#include "SDL_kmsdrmvideo.h"
+#include "SDL_kmsdrmatomic.h"
+#include "SDL_kmsdrmdyn.h"
+#include <errno.h>
+#include <drm_fourcc.h>
+
+/* If no frame has been committed for this long, queued property changes
+   (cursor moves, mostly) are committed on their own instead of waiting for
+   the next frame to carry them. */
+#define KMSDRM_ATOMIC_IDLE_MS 50
+
+/*****************************************************************************/
+/* Property helpers                                                          */
+/*****************************************************************************/
+
+static void
+KMSDRM_FreeObjectProps(KMSDRM_ObjectProps *obj)
+{
+    uint32_t i;
+
+    if (obj->props_info) {
+        for (i = 0; i < obj->props->count_props; i++) {
+            if (obj->props_info[i]) {
+                KMSDRM_drmModeFreeProperty(obj->props_info[i]);
+            }
+        }
+        SDL_free(obj->props_info);
+    }
+
+    if (obj->props) {
+        KMSDRM_drmModeFreeObjectProperties(obj->props);
+    }
+
+    SDL_zerop(obj);
+}
+
+static SDL_bool
+KMSDRM_GetObjectProps(int drm_fd, uint32_t obj_id, uint32_t obj_type, KMSDRM_ObjectProps *obj)
+{
+    uint32_t i;
+
+    SDL_zerop(obj);
+
+    obj->props = KMSDRM_drmModeObjectGetProperties(drm_fd, obj_id, obj_type);
+    if (!obj->props) {
+        return SDL_FALSE;
+    }
+
+    obj->props_info = (drmModePropertyRes **) SDL_calloc(obj->props->count_props + 1,
+                                                         sizeof(drmModePropertyRes *));
+    if (!obj->props_info) {
+        KMSDRM_FreeObjectProps(obj);
+        SDL_OutOfMemory();
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < obj->props->count_props; i++) {
+        obj->props_info[i] = KMSDRM_drmModeGetProperty(drm_fd, obj->props->props[i]);
+    }
+
+    obj->obj_id = obj_id;
+    obj->obj_type = obj_type;
+
+    return SDL_TRUE;
+}
+
+uint32_t
+KMSDRM_GetPropertyId(const KMSDRM_ObjectProps *obj, const char *name)
+{
+    uint32_t i;
+
+    if (!obj->props) {
+        return 0;
+    }
+
+    for (i = 0; i < obj->props->count_props; i++) {
+        if (obj->props_info[i] && SDL_strcmp(obj->props_info[i]->name, name) == 0) {
+            return obj->props_info[i]->prop_id;
+        }
+    }
+
+    return 0;
+}
+
+SDL_bool
+KMSDRM_GetPropertyValue(const KMSDRM_ObjectProps *obj, const char *name, uint64_t *value)
+{
+    uint32_t i;
+
+    if (!obj->props) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < obj->props->count_props; i++) {
+        if (obj->props_info[i] && SDL_strcmp(obj->props_info[i]->name, name) == 0) {
+            *value = obj->props->prop_values[i];
+            return SDL_TRUE;
+        }
+    }
+
+    return SDL_FALSE;
+}
+
+int
+KMSDRM_AtomicAddProperty(drmModeAtomicReq *req, const KMSDRM_ObjectProps *obj,
+                         const char *name, uint64_t value)
+{
+    uint32_t prop_id = KMSDRM_GetPropertyId(obj, name);
+    int ret;
+
+    if (prop_id == 0) {
+        return SDL_SetError("DRM object %u has no \"%s\" property", obj->obj_id, name);
+    }
+
+    /* drmModeAtomicAddProperty() returns the new request size on success. */
+    ret = KMSDRM_drmModeAtomicAddProperty(req, obj->obj_id, prop_id, value);
+    if (ret < 0) {
+        return SDL_SetError("Could not add \"%s\" to atomic request (%d)", name, ret);
+    }
+
+    return 0;
+}
+
+/* Point a plane to a framebuffer. Source coordinates are 16.16 fixed point. */
+static int
+KMSDRM_AtomicSetPlane(drmModeAtomicReq *req, const KMSDRM_ObjectProps *plane,
+                      uint32_t crtc_id, uint32_t fb_id, uint32_t src_w, uint32_t src_h,
+                      int crtc_x, int crtc_y, uint32_t crtc_w, uint32_t crtc_h)
+{
+    if (KMSDRM_AtomicAddProperty(req, plane, "FB_ID", fb_id) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "CRTC_ID", crtc_id) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "SRC_X", 0) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "SRC_Y", 0) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "SRC_W", (uint64_t)src_w << 16) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "SRC_H", (uint64_t)src_h << 16) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "CRTC_X", (uint64_t)(int64_t)crtc_x) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "CRTC_Y", (uint64_t)(int64_t)crtc_y) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "CRTC_W", crtc_w) < 0 ||
+        KMSDRM_AtomicAddProperty(req, plane, "CRTC_H", crtc_h) < 0) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Find the first plane of the given type (DRM_PLANE_TYPE_*) usable on the
+   display's CRTC. */
+static SDL_bool
+KMSDRM_FindPlane(int drm_fd, SDL_DisplayData *dispdata, uint64_t type, KMSDRM_ObjectProps *out)
+{
+    drmModePlaneRes *plane_res;
+    SDL_bool found = SDL_FALSE;
+    uint32_t i;
+
+    plane_res = KMSDRM_drmModeGetPlaneResources(drm_fd);
+    if (!plane_res) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < plane_res->count_planes && !found; i++) {
+        drmModePlane *plane = KMSDRM_drmModeGetPlane(drm_fd, plane_res->planes[i]);
+        uint64_t plane_type;
+
+        if (!plane) {
+            continue;
+        }
+
+        if ((plane->possible_crtcs & (1 << dispdata->crtc_index)) &&
+            KMSDRM_GetObjectProps(drm_fd, plane->plane_id, DRM_MODE_OBJECT_PLANE, out)) {
+            if (KMSDRM_GetPropertyValue(out, "type", &plane_type) && plane_type == type) {
+                found = SDL_TRUE;
+            } else {
+                KMSDRM_FreeObjectProps(out);
+            }
+        }
+
+        KMSDRM_drmModeFreePlane(plane);
+    }
+
+    KMSDRM_drmModeFreePlaneResources(plane_res);
+
+    return found;
+}
+
+/*****************************************************************************/
+/* Display setup/teardown                                                    */
+/*****************************************************************************/
+
+/* Called on GBM init, once the DRM FD has been reopened: client caps are
+   per-FD, so this can't be done on VideoInit(). Leaves dispdata->atomic unset
+   if anything is missing, and the legacy path is used for this display. */
+void
+KMSDRM_InitAtomic(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    int drm_fd = viddata->drm_fd;
+
+    dispdata->atomic = SDL_FALSE;
+    dispdata->atomic_tested = SDL_FALSE;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_KMSDRM_ATOMIC, SDL_TRUE)) {
+        return;
+    }
+
+    /* Universal planes are needed to see the primary and cursor planes,
+       and the connector CRTC_ID property only shows up with atomic enabled,
+       so both caps go before any property query. */
+    if (KMSDRM_drmSetClientCap(drm_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) ||
+        KMSDRM_drmSetClientCap(drm_fd, DRM_CLIENT_CAP_ATOMIC, 1)) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Atomic modesetting not supported, using legacy path");
+        return;
+    }
+
+    if (!KMSDRM_GetObjectProps(drm_fd, dispdata->crtc->crtc_id,
+                               DRM_MODE_OBJECT_CRTC, &dispdata->crtc_props) ||
+        !KMSDRM_GetObjectProps(drm_fd, dispdata->connector->connector_id,
+                               DRM_MODE_OBJECT_CONNECTOR, &dispdata->connector_props) ||
+        !KMSDRM_FindPlane(drm_fd, dispdata, DRM_PLANE_TYPE_PRIMARY, &dispdata->plane_props)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO,
+                    "Could not get atomic properties for CRTC %u, using legacy path",
+                    dispdata->crtc->crtc_id);
+        KMSDRM_DeinitAtomic(_this, dispdata);
+        return;
+    }
+
+    /* Not having a cursor plane is fine, the legacy cursor ioctls are used then. */
+    KMSDRM_FindPlane(drm_fd, dispdata, DRM_PLANE_TYPE_CURSOR, &dispdata->cursor_plane_props);
+
+    dispdata->atomic_lock = SDL_CreateMutex();
+    dispdata->atomic_pending = KMSDRM_drmModeAtomicAlloc();
+    if (!dispdata->atomic_lock || !dispdata->atomic_pending) {
+        KMSDRM_DeinitAtomic(_this, dispdata);
+        return;
+    }
+
+    /* Remember what's on the CRTC right now, so the first commit only asks
+       for a full modeset if the mode actually changes. */
+    if (dispdata->crtc->mode_valid) {
+        dispdata->atomic_mode = dispdata->crtc->mode;
+    } else {
+        SDL_zero(dispdata->atomic_mode);
+    }
+
+    dispdata->atomic = SDL_TRUE;
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
+                 "Using atomic modesetting on CRTC %u (primary plane %u, cursor plane %u)",
+                 dispdata->crtc->crtc_id, dispdata->plane_props.obj_id,
+                 dispdata->cursor_plane_props.obj_id);
+}
+
+void
+KMSDRM_DeinitAtomic(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+
+    if (dispdata->mode_blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, dispdata->mode_blob_id);
+        dispdata->mode_blob_id = 0;
+    }
+
+    if (dispdata->atomic_pending) {
+        KMSDRM_drmModeAtomicFree(dispdata->atomic_pending);
+        dispdata->atomic_pending = NULL;
+    }
+
+    if (dispdata->atomic_lock) {
+        SDL_DestroyMutex(dispdata->atomic_lock);
+        dispdata->atomic_lock = NULL;
+    }
+
+    KMSDRM_FreeObjectProps(&dispdata->crtc_props);
+    KMSDRM_FreeObjectProps(&dispdata->connector_props);
+    KMSDRM_FreeObjectProps(&dispdata->plane_props);
+    KMSDRM_FreeObjectProps(&dispdata->cursor_plane_props);
+
+    dispdata->atomic = SDL_FALSE;
+    dispdata->atomic_tested = SDL_FALSE;
+}
+
+/*****************************************************************************/
+/* Variable refresh rate                                                     */
+/*****************************************************************************/
+
+/* Enable VRR on the display's CRTC if its connector says the sink can do it.
+   Works on both paths: with atomic, the change rides along with the first
+   frame commit and only counts as enabled once that went through, otherwise
+   it's set right away. */
+void
+KMSDRM_InitVRR(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    KMSDRM_ObjectProps crtc_props, connector_props;
+    const KMSDRM_ObjectProps *crtc = &dispdata->crtc_props;
+    const KMSDRM_ObjectProps *connector = &dispdata->connector_props;
+    uint64_t capable = 0;
+    uint32_t prop_id;
+    int ret;
+
+    dispdata->vrr_enabled = SDL_FALSE;
+    dispdata->vrr_pending = SDL_FALSE;
+    dispdata->vrr_prop_id = 0;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_KMSDRM_VRR, SDL_TRUE)) {
+        return;
+    }
+
+    SDL_zero(crtc_props);
+    SDL_zero(connector_props);
+
+    /* The legacy path doesn't keep the properties around */
+    if (!dispdata->atomic) {
+        if (!KMSDRM_GetObjectProps(viddata->drm_fd, dispdata->crtc->crtc_id,
+                                   DRM_MODE_OBJECT_CRTC, &crtc_props) ||
+            !KMSDRM_GetObjectProps(viddata->drm_fd, dispdata->connector->connector_id,
+                                   DRM_MODE_OBJECT_CONNECTOR, &connector_props)) {
+            goto cleanup;
+        }
+        crtc = &crtc_props;
+        connector = &connector_props;
+    }
+
+    prop_id = KMSDRM_GetPropertyId(crtc, "VRR_ENABLED");
+    if (!KMSDRM_GetPropertyValue(connector, "vrr_capable", &capable) || !capable || !prop_id) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Connector %u isn't VRR capable, using a fixed refresh rate",
+                     dispdata->connector->connector_id);
+        goto cleanup;
+    }
+
+    if (dispdata->atomic) {
+        ret = KMSDRM_AtomicQueueProperty(dispdata, crtc, "VRR_ENABLED", 1);
+    } else {
+        ret = KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->crtc->crtc_id,
+                                              DRM_MODE_OBJECT_CRTC, prop_id, 1);
+    }
+
+    if (ret == 0) {
+        dispdata->vrr_prop_id = prop_id;
+        if (dispdata->atomic) {
+            dispdata->vrr_pending = SDL_TRUE;
+        } else {
+            dispdata->vrr_enabled = SDL_TRUE;
+            SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Variable refresh rate enabled on CRTC %u",
+                         dispdata->crtc->crtc_id);
+        }
+    }
+
+cleanup:
+    KMSDRM_FreeObjectProps(&crtc_props);
+    KMSDRM_FreeObjectProps(&connector_props);
+}
+
+/* Leave the CRTC at a fixed rate for whoever comes next. */
+void
+KMSDRM_DeinitVRR(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+
+    if (dispdata->vrr_enabled) {
+        KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->crtc->crtc_id,
+                                        DRM_MODE_OBJECT_CRTC, dispdata->vrr_prop_id, 0);
+        dispdata->vrr_enabled = SDL_FALSE;
+    }
+    dispdata->vrr_pending = SDL_FALSE;
+}
+
+/* A commit carrying the queued VRR_ENABLED went through, or the atomic path
+   was dropped before one could: then set it the legacy way. */
+static void
+KMSDRM_SettleVRR(_THIS, SDL_DisplayData *dispdata, SDL_bool committed)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+
+    if (!dispdata->vrr_pending) {
+        return;
+    }
+    dispdata->vrr_pending = SDL_FALSE;
+
+    if (!committed &&
+        KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->crtc->crtc_id,
+                                        DRM_MODE_OBJECT_CRTC, dispdata->vrr_prop_id, 1) != 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Couldn't enable variable refresh rate on CRTC %u",
+                     dispdata->crtc->crtc_id);
+        return;
+    }
+
+    dispdata->vrr_enabled = SDL_TRUE;
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Variable refresh rate enabled on CRTC %u",
+                 dispdata->crtc->crtc_id);
+}
+
+/*****************************************************************************/
+/* Color management                                                          */
+/*****************************************************************************/
+
+/* Stages of the CRTC color pipeline, in the order pixels go through them */
+static const char *color_props[3] = { "DEGAMMA_LUT", "CTM", "GAMMA_LUT" };
+
+/* What SDL_KMSDRMColorLUTEntry hands us goes straight into the blobs */
+SDL_COMPILE_TIME_ASSERT(color_lut, sizeof(SDL_KMSDRMColorLUTEntry) == sizeof(struct drm_color_lut));
+
+/* The legacy path doesn't keep the CRTC properties around, get them if needed.
+   Returns the ones to use, or NULL. */
+static const KMSDRM_ObjectProps *
+KMSDRM_GetCrtcProps(_THIS, SDL_DisplayData *dispdata, KMSDRM_ObjectProps *tmp)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+
+    SDL_zerop(tmp);
+    if (dispdata->atomic) {
+        return &dispdata->crtc_props;
+    }
+    if (viddata->drm_fd < 0 ||
+        !KMSDRM_GetObjectProps(viddata->drm_fd, dispdata->crtc->crtc_id, DRM_MODE_OBJECT_CRTC, tmp)) {
+        return NULL;
+    }
+    return tmp;
+}
+
+/* Put everything back to bypass for whoever comes next. */
+void
+KMSDRM_DeinitColor(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    const KMSDRM_ObjectProps *crtc;
+    KMSDRM_ObjectProps tmp;
+    int i;
+
+    if (!dispdata->color_blob_ids[0] && !dispdata->color_blob_ids[1] && !dispdata->color_blob_ids[2]) {
+        return;
+    }
+
+    crtc = KMSDRM_GetCrtcProps(_this, dispdata, &tmp);
+    for (i = 0; i < SDL_arraysize(color_props); i++) {
+        if (dispdata->color_blob_ids[i]) {
+            if (crtc) {
+                KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->crtc->crtc_id, DRM_MODE_OBJECT_CRTC,
+                                                KMSDRM_GetPropertyId(crtc, color_props[i]), 0);
+            }
+            KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, dispdata->color_blob_ids[i]);
+            dispdata->color_blob_ids[i] = 0;
+        }
+    }
+    KMSDRM_FreeObjectProps(&tmp);
+}
+
+#ifdef __LINUX__
+int
+KMSDRM_GetColorPipeline(_THIS, SDL_Window *window, int *degamma_size, SDL_bool *has_ctm, int *gamma_size)
+{
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
+    const KMSDRM_ObjectProps *crtc;
+    KMSDRM_ObjectProps tmp;
+    uint64_t value;
+
+    crtc = KMSDRM_GetCrtcProps(_this, dispdata, &tmp);
+    if (!crtc) {
+        return SDL_SetError("Could not get the CRTC properties");
+    }
+
+    if (degamma_size) {
+        *degamma_size = (KMSDRM_GetPropertyId(crtc, "DEGAMMA_LUT") &&
+                         KMSDRM_GetPropertyValue(crtc, "DEGAMMA_LUT_SIZE", &value)) ? (int)value : 0;
+    }
+    if (has_ctm) {
+        *has_ctm = KMSDRM_GetPropertyId(crtc, "CTM") ? SDL_TRUE : SDL_FALSE;
+    }
+    if (gamma_size) {
+        *gamma_size = (KMSDRM_GetPropertyId(crtc, "GAMMA_LUT") &&
+                       KMSDRM_GetPropertyValue(crtc, "GAMMA_LUT_SIZE", &value)) ? (int)value : 0;
+    }
+
+    KMSDRM_FreeObjectProps(&tmp);
+    return 0;
+}
+
+/* S31.32 sign-magnitude, what the kernel wants for CTM coefficients */
+static uint64_t
+KMSDRM_CTMCoefficient(float value)
+{
+    uint64_t magnitude = (uint64_t)(SDL_fabs(value) * 4294967296.0);
+
+    if (value < 0.0f) {
+        magnitude |= 1ULL << 63;
+    }
+    return magnitude;
+}
+
+/* All the stages change together: atomic displays get them with the next frame
+   commit (or on their own if the screen is idle), legacy ones right away. */
+int
+KMSDRM_SetColorPipeline(_THIS, SDL_Window *window, const SDL_KMSDRMColorLUTEntry *degamma,
+                        const float *ctm, const SDL_KMSDRMColorLUTEntry *gamma)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
+    const KMSDRM_ObjectProps *crtc;
+    KMSDRM_ObjectProps tmp;
+    struct drm_color_ctm ctm_blob;
+    const void *data[3];
+    size_t size[3];
+    uint32_t blob_ids[3] = { 0, 0, 0 };
+    int degamma_size, gamma_size;
+    SDL_bool has_ctm;
+    int i, ret = 0;
+
+    if (KMSDRM_GetColorPipeline(_this, window, &degamma_size, &has_ctm, &gamma_size) < 0) {
+        return -1;
+    }
+    if ((degamma && !degamma_size) || (ctm && !has_ctm) || (gamma && !gamma_size)) {
+        return SDL_Unsupported();
+    }
+
+    if (ctm) {
+        for (i = 0; i < 9; i++) {
+            ctm_blob.matrix[i] = KMSDRM_CTMCoefficient(ctm[i]);
+        }
+    }
+
+    data[0] = degamma;
+    size[0] = degamma_size * sizeof(struct drm_color_lut);
+    data[1] = ctm ? &ctm_blob : NULL;
+    size[1] = sizeof(ctm_blob);
+    data[2] = gamma;
+    size[2] = gamma_size * sizeof(struct drm_color_lut);
+
+    for (i = 0; i < SDL_arraysize(color_props); i++) {
+        if (data[i] && KMSDRM_drmModeCreatePropertyBlob(viddata->drm_fd, data[i], size[i], &blob_ids[i])) {
+            ret = SDL_SetError("Could not create the %s blob", color_props[i]);
+            goto cleanup;
+        }
+    }
+
+    crtc = KMSDRM_GetCrtcProps(_this, dispdata, &tmp);
+    if (!crtc) {
+        ret = SDL_SetError("Could not get the CRTC properties");
+        goto cleanup;
+    }
+
+    for (i = 0; i < SDL_arraysize(color_props) && ret == 0; i++) {
+        if (!KMSDRM_GetPropertyId(crtc, color_props[i])) {
+            continue;   /* Bypassed, since it isn't there */
+        }
+        if (dispdata->atomic) {
+            ret = KMSDRM_AtomicQueueProperty(dispdata, crtc, color_props[i], blob_ids[i]);
+        } else {
+            ret = KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->crtc->crtc_id, DRM_MODE_OBJECT_CRTC,
+                                                  KMSDRM_GetPropertyId(crtc, color_props[i]), blob_ids[i]);
+        }
+    }
+    KMSDRM_FreeObjectProps(&tmp);
+
+    if (ret) {
+        ret = SDL_SetError("Could not set the color pipeline");
+        goto cleanup;
+    }
+
+    /* The CRTC holds on to what it uses, the IDs of the old blobs can go.
+       A queued change that wasn't committed yet is replaced by the new one. */
+    for (i = 0; i < SDL_arraysize(color_props); i++) {
+        if (dispdata->color_blob_ids[i]) {
+            KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, dispdata->color_blob_ids[i]);
+        }
+        dispdata->color_blob_ids[i] = blob_ids[i];
+        blob_ids[i] = 0;
+    }
+
+    if (dispdata->atomic) {
+        ret = KMSDRM_AtomicFlush(_this, dispdata);
+    }
+
+cleanup:
+    for (i = 0; i < SDL_arraysize(color_props); i++) {
+        if (blob_ids[i]) {
+            KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, blob_ids[i]);
+        }
+    }
+    return ret;
+}
+#endif /* __LINUX__ */
+
+/*****************************************************************************/
+/* Scanout format modifiers                                                  */
+/*****************************************************************************/
+
+/* Get the modifiers the primary plane can scan out XRGB8888 with, from its
+   IN_FORMATS blob, so buffers can be allocated tiled or compressed instead
+   of with the driver's implicit (often linear) layout. Needs the plane's
+   properties, so only displays driven with atomic get a list. */
+void
+KMSDRM_InitModifiers(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    drmModePropertyBlobRes *blob;
+    const struct drm_format_modifier_blob *header;
+    const uint32_t *formats;
+    const struct drm_format_modifier *mods;
+    uint64_t blob_id, cap = 0;
+    SDL_bool non_linear = SDL_FALSE;
+    uint32_t i, format_index;
+
+    dispdata->modifiers = NULL;
+    dispdata->num_modifiers = 0;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_KMSDRM_MODIFIERS, SDL_TRUE) ||
+        !KMSDRM_drmModeAddFB2WithModifiers || !KMSDRM_gbm_surface_create_with_modifiers ||
+        !KMSDRM_gbm_bo_get_modifier || !KMSDRM_gbm_bo_get_plane_count ||
+        !KMSDRM_gbm_bo_get_handle_for_plane || !KMSDRM_gbm_bo_get_stride_for_plane ||
+        !KMSDRM_gbm_bo_get_offset) {
+        return;
+    }
+
+    if (KMSDRM_drmGetCap(viddata->drm_fd, DRM_CAP_ADDFB2_MODIFIERS, &cap) || !cap ||
+        !dispdata->plane_props.props ||
+        !KMSDRM_GetPropertyValue(&dispdata->plane_props, "IN_FORMATS", &blob_id)) {
+        return;
+    }
+
+    blob = KMSDRM_drmModeGetPropertyBlob(viddata->drm_fd, (uint32_t)blob_id);
+    if (!blob) {
+        return;
+    }
+
+    header = (const struct drm_format_modifier_blob *)blob->data;
+    formats = (const uint32_t *)((const Uint8 *)blob->data + header->formats_offset);
+    mods = (const struct drm_format_modifier *)((const Uint8 *)blob->data + header->modifiers_offset);
+
+    for (format_index = 0; format_index < header->count_formats; format_index++) {
+        if (formats[format_index] == DRM_FORMAT_XRGB8888) {
+            break;
+        }
+    }
+
+    if (format_index < header->count_formats) {
+        dispdata->modifiers = SDL_calloc(header->count_modifiers, sizeof(uint64_t));
+    }
+
+    /* Each modifier has a bitmask of the formats it applies to, for a
+       window of 64 formats starting at its offset. */
+    for (i = 0; dispdata->modifiers && i < header->count_modifiers; i++) {
+        if (format_index < mods[i].offset || format_index >= mods[i].offset + 64 ||
+            !(mods[i].formats & (1ULL << (format_index - mods[i].offset))) ||
+            mods[i].modifier == DRM_FORMAT_MOD_INVALID) {
+            continue;
+        }
+
+        dispdata->modifiers[dispdata->num_modifiers++] = mods[i].modifier;
+        if (mods[i].modifier != DRM_FORMAT_MOD_LINEAR) {
+            non_linear = SDL_TRUE;
+        }
+    }
+
+    KMSDRM_drmModeFreePropertyBlob(blob);
+
+    /* Linear only: the implicit path allocates the same thing. */
+    if (!non_linear) {
+        KMSDRM_DeinitModifiers(_this, dispdata);
+        return;
+    }
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Primary plane %u has %d XRGB8888 modifiers",
+                 dispdata->plane_props.obj_id, dispdata->num_modifiers);
+}
+
+void
+KMSDRM_DeinitModifiers(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_free(dispdata->modifiers);
+    dispdata->modifiers = NULL;
+    dispdata->num_modifiers = 0;
+}
+
+/*****************************************************************************/
+/* Frame presentation                                                        */
+/*****************************************************************************/
+
+/* Route the connector to the display's CRTC and make sure it's lit. Setting
+   values that are already there doesn't cost a modeset. A MODE_ID blob is
+   created if the mode changes: it's returned in *blob_id and the caller owns it. */
+static int
+KMSDRM_AtomicAddModeset(_THIS, drmModeAtomicReq *req, SDL_DisplayData *dispdata, uint32_t *blob_id)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+
+    if (SDL_memcmp(&dispdata->atomic_mode, &dispdata->mode, sizeof(dispdata->mode)) != 0) {
+        if (KMSDRM_drmModeCreatePropertyBlob(viddata->drm_fd, &dispdata->mode,
+                                             sizeof(dispdata->mode), blob_id) != 0) {
+            return SDL_SetError("Could not create mode property blob");
+        }
+
+        if (KMSDRM_AtomicAddProperty(req, &dispdata->crtc_props, "MODE_ID", *blob_id) < 0) {
+            return -1;
+        }
+    }
+
+    if (KMSDRM_AtomicAddProperty(req, &dispdata->connector_props, "CRTC_ID",
+                                 dispdata->crtc->crtc_id) < 0 ||
+        KMSDRM_AtomicAddProperty(req, &dispdata->crtc_props, "ACTIVE", 1) < 0) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Fill a request with everything needed to show fb_id on the display's
+   primary plane, see KMSDRM_AtomicAddModeset() for modeset and blob_id. */
+static int
+KMSDRM_AtomicAddFrame(_THIS, drmModeAtomicReq *req, SDL_WindowData *windata,
+                      SDL_DisplayData *dispdata, uint32_t fb_id, uint32_t width,
+                      uint32_t height, SDL_bool modeset, uint32_t *blob_id)
+{
+    if (modeset && KMSDRM_AtomicAddModeset(_this, req, dispdata, blob_id) < 0) {
+        return -1;
+    }
+
+    /* Always set the rotation when the plane has it, so a rotation left
+       behind by someone else doesn't stick. */
+    if (KMSDRM_GetPropertyId(&dispdata->plane_props, "rotation") &&
+        KMSDRM_AtomicAddProperty(req, &dispdata->plane_props, "rotation",
+                                 windata->plane_scaling ? windata->plane_rotation : DRM_MODE_ROTATE_0) < 0) {
+        return -1;
+    }
+
+    if (windata->plane_scaling) {
+        return KMSDRM_AtomicSetPlane(req, &dispdata->plane_props, dispdata->crtc->crtc_id, fb_id,
+                                     width, height, windata->plane_rect.x, windata->plane_rect.y,
+                                     windata->plane_rect.w, windata->plane_rect.h);
+    }
+
+    return KMSDRM_AtomicSetPlane(req, &dispdata->plane_props, dispdata->crtc->crtc_id, fb_id,
+                                 width, height, 0, 0, dispdata->mode.hdisplay, dispdata->mode.vdisplay);
+}
+
+/* Show the same FB on a clone display: rotated like on the window's own
+   display, and scaled to fit the clone's mode, keeping the aspect ratio.
+   When the sizes match, it's scanned out as is. */
+static int
+KMSDRM_AtomicAddClone(_THIS, drmModeAtomicReq *req, SDL_WindowData *windata,
+                      SDL_DisplayData *clone, uint32_t fb_id, uint32_t width,
+                      uint32_t height, SDL_bool modeset, uint32_t *blob_id)
+{
+    uint64_t rotation = windata->plane_scaling ? windata->plane_rotation : DRM_MODE_ROTATE_0;
+    int view_w = clone->mode.hdisplay;
+    int view_h = clone->mode.vdisplay;
+    int plane_w = (rotation & (DRM_MODE_ROTATE_90 | DRM_MODE_ROTATE_270)) ? height : width;
+    int plane_h = (rotation & (DRM_MODE_ROTATE_90 | DRM_MODE_ROTATE_270)) ? width : height;
+    SDL_Rect rect;
+
+    if (modeset && KMSDRM_AtomicAddModeset(_this, req, clone, blob_id) < 0) {
+        return -1;
+    }
+
+    if (KMSDRM_GetPropertyId(&clone->plane_props, "rotation")) {
+        if (KMSDRM_AtomicAddProperty(req, &clone->plane_props, "rotation", rotation) < 0) {
+            return -1;
+        }
+    } else if (rotation != DRM_MODE_ROTATE_0) {
+        return SDL_SetError("Plane can't rotate");
+    }
+
+    if ((Sint64)view_w * plane_h > (Sint64)view_h * plane_w) {
+        rect.w = (int)((Sint64)plane_w * view_h / plane_h);
+        rect.h = view_h;
+    } else {
+        rect.w = view_w;
+        rect.h = (int)((Sint64)plane_h * view_w / plane_w);
+    }
+    rect.x = (view_w - rect.w) / 2;
+    rect.y = (view_h - rect.h) / 2;
+
+    return KMSDRM_AtomicSetPlane(req, &clone->plane_props, clone->crtc->crtc_id, fb_id,
+                                 width, height, rect.x, rect.y, rect.w, rect.h);
+}
+
+/* Can frames be committed with the GPU's fence for the kernel to wait on? */
+SDL_bool
+KMSDRM_AtomicHasInFence(SDL_DisplayData *dispdata)
+{
+    return dispdata->atomic && KMSDRM_GetPropertyId(&dispdata->plane_props, "IN_FENCE_FD") != 0;
+}
+
+/* Present a BO on the display's primary plane, along with any queued
+   property changes, in a single nonblocking commit. The page flip event
+   is delivered to KMSDRM_FlipHandler() like a legacy drmModePageFlip().
+   On the first frame the commit is validated with TEST_ONLY: if the driver
+   rejects it, dispdata->atomic is cleared so the caller falls back to the
+   legacy path for good. The damage, in BO coordinates, goes to the plane's
+   FB_DAMAGE_CLIPS, if it has them: NULL means the whole BO changed. A fence
+   FD other than -1 makes the kernel wait for rendering, it's not closed. */
+int
+KMSDRM_AtomicCommitFrame(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                         struct gbm_bo *bo, KMSDRM_FBInfo *fb_info, SDL_bool first_frame,
+                         const KMSDRM_Damage *damage, int in_fence_fd)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    drmModeAtomicReq *req;
+    uint32_t flags = DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT;
+    uint32_t blob_id = 0, damage_blob_id = 0;
+    uint32_t clone_blob_ids[KMSDRM_MAX_CLONES] = { 0 };
+    int i, ret = 0;
+
+    req = KMSDRM_drmModeAtomicAlloc();
+    if (!req) {
+        return SDL_OutOfMemory();
+    }
+
+    if (first_frame) {
+        flags |= DRM_MODE_ATOMIC_ALLOW_MODESET;
+    }
+
+    if (KMSDRM_AtomicAddFrame(_this, req, windata, dispdata, fb_info->fb_id,
+                              KMSDRM_gbm_bo_get_width(bo), KMSDRM_gbm_bo_get_height(bo),
+                              first_frame, &blob_id) < 0) {
+        ret = -1;
+        goto cleanup;
+    }
+
+    /* Same FB on the clones, they flip along. They were checked with the
+       window's surfaces, see KMSDRM_AtomicTestClone(). */
+    for (i = 0; i < windata->num_clones; i++) {
+        if (KMSDRM_AtomicAddClone(_this, req, windata, windata->clones[i], fb_info->fb_id,
+                                  KMSDRM_gbm_bo_get_width(bo), KMSDRM_gbm_bo_get_height(bo),
+                                  first_frame, &clone_blob_ids[i]) < 0) {
+            ret = -1;
+            goto cleanup;
+        }
+    }
+
+    if (in_fence_fd >= 0 &&
+        KMSDRM_AtomicAddProperty(req, &dispdata->plane_props, "IN_FENCE_FD", in_fence_fd) < 0) {
+        ret = -1;
+        goto cleanup;
+    }
+
+    /* Some drivers only upload or compose what changed. It's only a hint,
+       so the frame goes out anyway if the blob can't be made. */
+    if (damage && damage->partial && damage->num_rects > 0 && !first_frame &&
+        KMSDRM_GetPropertyId(&dispdata->plane_props, "FB_DAMAGE_CLIPS")) {
+        struct drm_mode_rect clips[KMSDRM_MAX_DAMAGE_RECTS];
+
+        for (i = 0; i < damage->num_rects; i++) {
+            clips[i].x1 = damage->rects[i].x;
+            clips[i].y1 = damage->rects[i].y;
+            clips[i].x2 = damage->rects[i].x + damage->rects[i].w;
+            clips[i].y2 = damage->rects[i].y + damage->rects[i].h;
+        }
+
+        if (KMSDRM_drmModeCreatePropertyBlob(viddata->drm_fd, clips, sizeof(clips[0]) * damage->num_rects,
+                                             &damage_blob_id) == 0) {
+            KMSDRM_AtomicAddProperty(req, &dispdata->plane_props, "FB_DAMAGE_CLIPS", damage_blob_id);
+        }
+    }
+
+    SDL_LockMutex(dispdata->atomic_lock);
+
+    /* Cursor moves, property changes... all land on the same vblank. */
+    KMSDRM_drmModeAtomicMerge(req, dispdata->atomic_pending);
+
+    if (!dispdata->atomic_tested) {
+        /* Events can't be requested on TEST_ONLY commits. */
+        ret = KMSDRM_drmModeAtomicCommit(viddata->drm_fd, req,
+                  (flags & ~(DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT)) |
+                  DRM_MODE_ATOMIC_TEST_ONLY, NULL);
+
+        if (ret) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO,
+                        "Atomic commit rejected by the driver (%d), falling back to legacy modesetting", ret);
+            dispdata->atomic = SDL_FALSE;
+            KMSDRM_SettleVRR(_this, dispdata, SDL_FALSE);
+            SDL_UnlockMutex(dispdata->atomic_lock);
+            goto cleanup;
+        }
+
+        dispdata->atomic_tested = SDL_TRUE;
+    }
+
+    /* One flip event per CRTC */
+    windata->waiting_for_flip = SDL_TRUE;
+    windata->flips_pending = 1 + windata->num_clones;
+
+    KMSDRM_TimingSubmit(&windata->timing);
+    ret = KMSDRM_drmModeAtomicCommit(viddata->drm_fd, req, flags, windata);
+
+    if (ret == 0) {
+        KMSDRM_drmModeAtomicSetCursor(dispdata->atomic_pending, 0);
+        dispdata->atomic_last_commit = SDL_GetTicks();
+        KMSDRM_SettleVRR(_this, dispdata, SDL_TRUE);
+
+        if (blob_id) {
+            /* The CRTC holds a reference to the blob now. */
+            if (dispdata->mode_blob_id) {
+                KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, dispdata->mode_blob_id);
+            }
+            dispdata->mode_blob_id = blob_id;
+            blob_id = 0;
+        }
+
+        for (i = 0; i < windata->num_clones; i++) {
+            SDL_DisplayData *clone = windata->clones[i];
+            if (clone_blob_ids[i]) {
+                if (clone->mode_blob_id) {
+                    KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, clone->mode_blob_id);
+                }
+                clone->mode_blob_id = clone_blob_ids[i];
+                clone_blob_ids[i] = 0;
+            }
+            if (first_frame) {
+                clone->atomic_mode = clone->mode;
+            }
+        }
+
+        if (first_frame) {
+            dispdata->atomic_mode = dispdata->mode;
+        }
+    } else {
+        windata->waiting_for_flip = SDL_FALSE;
+        windata->flips_pending = 0;
+        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Atomic commit failed: %d", ret);
+    }
+
+    SDL_UnlockMutex(dispdata->atomic_lock);
+
+cleanup:
+    if (blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, blob_id);
+    }
+    for (i = 0; i < SDL_arraysize(clone_blob_ids); i++) {
+        if (clone_blob_ids[i]) {
+            KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, clone_blob_ids[i]);
+        }
+    }
+
+    /* The plane state keeps its own reference, if the commit went through */
+    if (damage_blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, damage_blob_id);
+    }
+
+    KMSDRM_drmModeAtomicFree(req);
+
+    return ret;
+}
+
+/* Work out where the plane has to put a width x height buffer for it to be
+   scaled like the blitter would, and check with a TEST_ONLY commit whether
+   the hardware can do it. On success windata->plane_scaling is set, and
+   frames are committed with the plane scaling and rotating the app's BOs. */
+SDL_bool
+KMSDRM_AtomicTestPlaneScaling(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                              int width, int height, int rotation)
+{
+    static const uint64_t rotations[4] = {
+        /* Same direction as the blitter's shaders: counter-clockwise. */
+        DRM_MODE_ROTATE_0, DRM_MODE_ROTATE_90, DRM_MODE_ROTATE_180, DRM_MODE_ROTATE_270
+    };
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    drmModeAtomicReq *req = NULL;
+    struct gbm_bo *bo = NULL;
+    KMSDRM_FBInfo *fb_info;
+    uint32_t blob_id = 0;
+    int view_w = dispdata->mode.hdisplay;
+    int view_h = dispdata->mode.vdisplay;
+    int plane_w = (rotation & 1) ? height : width;
+    int plane_h = (rotation & 1) ? width : height;
+    int ret;
+
+    windata->plane_scaling = SDL_FALSE;
+
+    if (!dispdata->atomic || width <= 0 || height <= 0) {
+        return SDL_FALSE;
+    }
+
+    if (rotation && !KMSDRM_GetPropertyId(&dispdata->plane_props, "rotation")) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Plane can't rotate, plane scaling disabled");
+        return SDL_FALSE;
+    }
+
+    /* Touch the edges of the screen along the axis with the least room,
+       center on the other one. */
+    if ((Sint64)view_w * plane_h > (Sint64)view_h * plane_w) {
+        windata->plane_rect.w = (int)((Sint64)plane_w * view_h / plane_h);
+        windata->plane_rect.h = view_h;
+    } else {
+        windata->plane_rect.w = view_w;
+        windata->plane_rect.h = (int)((Sint64)plane_h * view_w / plane_w);
+    }
+    windata->plane_rect.x = (view_w - windata->plane_rect.w) / 2;
+    windata->plane_rect.y = (view_h - windata->plane_rect.h) / 2;
+    windata->plane_rotation = rotations[rotation & 3];
+
+    /* The probe needs a real FB, with the same size and format the app's
+       surface will use. */
+    bo = KMSDRM_gbm_bo_create(viddata->gbm_dev, width, height, windata->scanout_format,
+                              GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (!bo) {
+        return SDL_FALSE;
+    }
+
+    fb_info = KMSDRM_FBFromBO(_this, bo);
+    req = KMSDRM_drmModeAtomicAlloc();
+    if (!fb_info || !req) {
+        ret = -1;
+        goto cleanup;
+    }
+
+    windata->plane_scaling = SDL_TRUE;
+    ret = KMSDRM_AtomicAddFrame(_this, req, windata, dispdata, fb_info->fb_id,
+                                width, height, SDL_TRUE, &blob_id);
+    if (ret == 0) {
+        ret = KMSDRM_drmModeAtomicCommit(viddata->drm_fd, req,
+                  DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET, NULL);
+    }
+
+cleanup:
+    windata->plane_scaling = (ret == 0);
+
+    if (windata->plane_scaling) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
+                     "Plane scaling %dx%d to %dx%d+%d+%d, rotation %d",
+                     width, height, windata->plane_rect.w, windata->plane_rect.h,
+                     windata->plane_rect.x, windata->plane_rect.y, rotation);
+    } else {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Plane scaling rejected (%d), using the blitter", ret);
+    }
+
+    if (blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, blob_id);
+    }
+    if (req) {
+        KMSDRM_drmModeAtomicFree(req);
+    }
+    /* The FB goes away with the BO, through its destroy callback. */
+    KMSDRM_gbm_bo_destroy(bo);
+
+    return windata->plane_scaling;
+}
+
+/* Check with a TEST_ONLY commit that a clone display can show the window's
+   width x height frames along with its own display, as they'll be
+   committed: the clone's plane may not be able to scale or rotate them. */
+SDL_bool
+KMSDRM_AtomicTestClone(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                       SDL_DisplayData *clone, int width, int height)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    drmModeAtomicReq *req = NULL;
+    struct gbm_bo *bo;
+    KMSDRM_FBInfo *fb_info;
+    uint32_t blob_id = 0, clone_blob_id = 0;
+    int ret;
+
+    if (!dispdata->atomic || !clone->atomic || width <= 0 || height <= 0) {
+        return SDL_FALSE;
+    }
+
+    bo = KMSDRM_gbm_bo_create(viddata->gbm_dev, width, height, windata->scanout_format,
+                              GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (!bo) {
+        return SDL_FALSE;
+    }
+
+    fb_info = KMSDRM_FBFromBO(_this, bo);
+    req = KMSDRM_drmModeAtomicAlloc();
+    if (!fb_info || !req) {
+        ret = -1;
+        goto cleanup;
+    }
+
+    ret = KMSDRM_AtomicAddFrame(_this, req, windata, dispdata, fb_info->fb_id,
+                                width, height, SDL_TRUE, &blob_id);
+    if (ret == 0) {
+        ret = KMSDRM_AtomicAddClone(_this, req, windata, clone, fb_info->fb_id,
+                                    width, height, SDL_TRUE, &clone_blob_id);
+    }
+    if (ret == 0) {
+        ret = KMSDRM_drmModeAtomicCommit(viddata->drm_fd, req,
+                  DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET, NULL);
+    }
+
+cleanup:
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Clone on CRTC %u %s (%d)",
+                 clone->crtc->crtc_id, ret == 0 ? "accepted" : "rejected", ret);
+
+    if (blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, blob_id);
+    }
+    if (clone_blob_id) {
+        KMSDRM_drmModeDestroyPropertyBlob(viddata->drm_fd, clone_blob_id);
+    }
+    if (req) {
+        KMSDRM_drmModeAtomicFree(req);
+    }
+    KMSDRM_gbm_bo_destroy(bo);
+
+    return (ret == 0);
+}
+
+/*****************************************************************************/
+/* Queued property changes                                                   */
+/*****************************************************************************/
+
+int
+KMSDRM_AtomicQueueProperty(SDL_DisplayData *dispdata, const KMSDRM_ObjectProps *obj,
+                           const char *name, uint64_t value)
+{
+    int ret;
+
+    SDL_LockMutex(dispdata->atomic_lock);
+    ret = KMSDRM_AtomicAddProperty(dispdata->atomic_pending, obj, name, value);
+    SDL_UnlockMutex(dispdata->atomic_lock);
+
+    return ret;
+}
+
+/* Commit queued property changes on their own, when no frames are being
+   presented to carry them (static screen, cursor moving over a paused game...).
+   While frames are flowing they are left to KMSDRM_AtomicCommitFrame(), since a
+   commit of our own in between would make the next page flip fail with EBUSY. */
+int
+KMSDRM_AtomicFlush(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    int ret = 0;
+
+    /* Until the first frame has gone through, the CRTC may not even be
+       routed to us: keep everything for the first frame commit. */
+    if (!dispdata->atomic || !dispdata->atomic_tested || viddata->drm_fd < 0) {
+        return 0;
+    }
+
+    SDL_LockMutex(dispdata->atomic_lock);
+
+    if (KMSDRM_drmModeAtomicGetCursor(dispdata->atomic_pending) > 0 &&
+        SDL_TICKS_PASSED(SDL_GetTicks(), dispdata->atomic_last_commit + KMSDRM_ATOMIC_IDLE_MS)) {
+
+        /* Blocking, so it's out of the way if a frame comes right after. */
+        ret = KMSDRM_drmModeAtomicCommit(viddata->drm_fd, dispdata->atomic_pending, 0, NULL);
+
+        if (ret == 0) {
+            KMSDRM_drmModeAtomicSetCursor(dispdata->atomic_pending, 0);
+        } else if (ret != -EBUSY) {
+            /* Don't keep retrying a request the driver doesn't like. */
+            KMSDRM_drmModeAtomicSetCursor(dispdata->atomic_pending, 0);
+            ret = SDL_SetError("Atomic property commit failed: %d", ret);
+        }
+    }
+
+    SDL_UnlockMutex(dispdata->atomic_lock);
+
+    return ret;
+}
+
+/*****************************************************************************/
+/* Cursor plane                                                              */
+/*****************************************************************************/
+
+/* Show a cursor BO at (x, y), or hide the cursor plane if bo is NULL. */
+int
+KMSDRM_AtomicSetCursor(_THIS, SDL_DisplayData *dispdata, struct gbm_bo *bo, int x, int y)
+{
+    const KMSDRM_ObjectProps *plane = &dispdata->cursor_plane_props;
+    KMSDRM_FBInfo *fb_info = NULL;
+    int ret;
+
+    if (bo) {
+        /* Keep the alpha channel: a depth 24 FB would show a black box. */
+        fb_info = KMSDRM_FBFromBOFormat(_this, bo, KMSDRM_gbm_bo_get_format(bo));
+        if (!fb_info) {
+            return SDL_SetError("Could not get a framebuffer for the cursor BO");
+        }
+    }
+
+    SDL_LockMutex(dispdata->atomic_lock);
+    if (fb_info) {
+        ret = KMSDRM_AtomicSetPlane(dispdata->atomic_pending, plane, dispdata->crtc->crtc_id,
+                                    fb_info->fb_id,
+                                    KMSDRM_gbm_bo_get_width(bo), KMSDRM_gbm_bo_get_height(bo),
+                                    x, y,
+                                    KMSDRM_gbm_bo_get_width(bo), KMSDRM_gbm_bo_get_height(bo));
+    } else if (KMSDRM_AtomicAddProperty(dispdata->atomic_pending, plane, "FB_ID", 0) < 0 ||
+               KMSDRM_AtomicAddProperty(dispdata->atomic_pending, plane, "CRTC_ID", 0) < 0) {
+        ret = -1;
+    } else {
+        ret = 0;
+    }
+    SDL_UnlockMutex(dispdata->atomic_lock);
+
+    if (ret == 0) {
+        ret = KMSDRM_AtomicFlush(_this, dispdata);
+    }
+
+    return ret;
+}
+
+int
+KMSDRM_AtomicMoveCursor(_THIS, SDL_DisplayData *dispdata, int x, int y)
+{
+    const KMSDRM_ObjectProps *plane = &dispdata->cursor_plane_props;
+    int ret = 0;
+
+    SDL_LockMutex(dispdata->atomic_lock);
+    if (KMSDRM_AtomicAddProperty(dispdata->atomic_pending, plane, "CRTC_X", (uint64_t)(int64_t)x) < 0 ||
+        KMSDRM_AtomicAddProperty(dispdata->atomic_pending, plane, "CRTC_Y", (uint64_t)(int64_t)y) < 0) {
+        ret = -1;
+    }
+    SDL_UnlockMutex(dispdata->atomic_lock);
+
+    if (ret == 0) {
+        ret = KMSDRM_AtomicFlush(_this, dispdata);
+    }
+
+    return ret;
+}
+
+#endif /* SDL_VIDEO_DRIVER_KMSDRM */
+
+/* vi: set ts=4 sw=4 expandtab: */
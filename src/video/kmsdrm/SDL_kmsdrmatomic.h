@@ -0,0 +1,79 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifndef SDL_kmsdrmatomic_h_
+#define SDL_kmsdrmatomic_h_
+
+#include "SDL_kmsdrmvideo.h"
+
+/* Plane rotation values, missing from older libdrm headers. */
+#ifndef DRM_MODE_ROTATE_0
+#define DRM_MODE_ROTATE_0   (1 << 0)
+#define DRM_MODE_ROTATE_90  (1 << 1)
+#define DRM_MODE_ROTATE_180 (1 << 2)
+#define DRM_MODE_ROTATE_270 (1 << 3)
+#endif
+
+/* Property helpers */
+extern uint32_t KMSDRM_GetPropertyId(const KMSDRM_ObjectProps *obj, const char *name);
+extern SDL_bool KMSDRM_GetPropertyValue(const KMSDRM_ObjectProps *obj, const char *name, uint64_t *value);
+extern int KMSDRM_AtomicAddProperty(drmModeAtomicReq *req, const KMSDRM_ObjectProps *obj,
+                                    const char *name, uint64_t value);
+
+/* Display setup/teardown, called on GBM init/deinit */
+extern void KMSDRM_InitAtomic(_THIS, SDL_DisplayData *dispdata);
+extern void KMSDRM_DeinitAtomic(_THIS, SDL_DisplayData *dispdata);
+
+/* Variable refresh rate, set up after atomic on GBM init */
+extern void KMSDRM_InitVRR(_THIS, SDL_DisplayData *dispdata);
+extern void KMSDRM_DeinitVRR(_THIS, SDL_DisplayData *dispdata);
+
+/* Color management, reset to bypass on GBM deinit */
+extern void KMSDRM_DeinitColor(_THIS, SDL_DisplayData *dispdata);
+
+/* Scanout format modifiers, set up after atomic on GBM init */
+extern void KMSDRM_InitModifiers(_THIS, SDL_DisplayData *dispdata);
+extern void KMSDRM_DeinitModifiers(_THIS, SDL_DisplayData *dispdata);
+
+/* Frame presentation */
+extern int KMSDRM_AtomicCommitFrame(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                                    struct gbm_bo *bo, KMSDRM_FBInfo *fb_info, SDL_bool first_frame,
+                                    const KMSDRM_Damage *damage, int in_fence_fd);
+extern SDL_bool KMSDRM_AtomicHasInFence(SDL_DisplayData *dispdata);
+extern SDL_bool KMSDRM_AtomicTestPlaneScaling(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                                              int width, int height, int rotation);
+extern SDL_bool KMSDRM_AtomicTestClone(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata,
+                                       SDL_DisplayData *clone, int width, int height);
+
+/* Property changes that ride along with the next frame commit */
+extern int KMSDRM_AtomicQueueProperty(SDL_DisplayData *dispdata, const KMSDRM_ObjectProps *obj,
+                                      const char *name, uint64_t value);
+extern int KMSDRM_AtomicFlush(_THIS, SDL_DisplayData *dispdata);
+
+/* Cursor plane */
+extern int KMSDRM_AtomicSetCursor(_THIS, SDL_DisplayData *dispdata, struct gbm_bo *bo, int x, int y);
+extern int KMSDRM_AtomicMoveCursor(_THIS, SDL_DisplayData *dispdata, int x, int y);
+
+#endif /* SDL_kmsdrmatomic_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -8,8 +8,11 @@
 
 #include "SDL_kmsdrmdyn.h"
 #include "SDL_kmsdrmvideo.h"
+#include "SDL_kmsdrmatomic.h"
 #include "SDL_kmsdrmblitter.h"
 
+#include <drm_fourcc.h>
+
 /* used to simplify code */
 typedef struct mat4 {
     GLfloat v[16];
@@ -105,7 +108,6 @@ KMSDRM_Blitter_CreateContext(_THIS, KMSDRM_Blitter *blitter, EGLSurface egl_surf
     // TODO:: Figure out how to properly handle these
     // as to properly decouple everything from the internal SDL functions.
     blitter->egl_display = _this->egl_data->egl_display;
-    blitter->config = _this->egl_data->egl_config;
 
     blitter->eglBindAPI(_this->egl_data->apitype);
     egl_context = blitter->eglCreateContext(blitter->egl_display,
@@ -120,6 +122,64 @@ KMSDRM_Blitter_CreateContext(_THIS, KMSDRM_Blitter *blitter, EGLSurface egl_surf
     return (SDL_GLContext) egl_context;
 }
 
+// The config's native visual has to be the output surface's GBM format,
+// or EGL won't make a window surface for it. Drivers list a few configs
+// per format, take the one with the least depth, stencil and samples.
+static EGLConfig
+KMSDRM_Blitter_ChooseConfig(KMSDRM_Blitter *blitter, uint32_t format)
+{
+    static const EGLint attribs[] = {
+        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        EGL_NONE
+    };
+    EGLConfig configs[128];
+    EGLConfig best = NULL;
+    EGLint num_configs = 0, best_extra = 0, i;
+
+    if (!blitter->eglChooseConfig(blitter->egl_display, attribs, configs,
+                                  SDL_arraysize(configs), &num_configs)) {
+        return NULL;
+    }
+
+    for (i = 0; i < num_configs; i++) {
+        EGLint visual_id = 0, depth = 0, stencil = 0, samples = 0, extra;
+
+        blitter->eglGetConfigAttrib(blitter->egl_display, configs[i], EGL_NATIVE_VISUAL_ID, &visual_id);
+        if ((uint32_t)visual_id != format) {
+            continue;
+        }
+
+        blitter->eglGetConfigAttrib(blitter->egl_display, configs[i], EGL_DEPTH_SIZE, &depth);
+        blitter->eglGetConfigAttrib(blitter->egl_display, configs[i], EGL_STENCIL_SIZE, &stencil);
+        blitter->eglGetConfigAttrib(blitter->egl_display, configs[i], EGL_SAMPLES, &samples);
+        extra = depth + stencil + samples;
+        if (!best || extra < best_extra) {
+            best = configs[i];
+            best_extra = extra;
+        }
+    }
+
+    return best;
+}
+
+// Output GBM surface and its EGL surface, in the blitter's format
+static int
+KMSDRM_Blitter_CreateSurface(_THIS, KMSDRM_Blitter *blitter, GLsizei width, GLsizei height)
+{
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(blitter->window)->driverdata;
+
+    blitter->gs = KMSDRM_CreateGBMSurface(_this, dispdata, width, height, blitter->format,
+                                          GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (!blitter->gs) {
+        return 0;
+    }
+
+    blitter->egl_surface = blitter->eglCreateWindowSurface(blitter->egl_display, blitter->config,
+                                                           (NativeWindowType)blitter->gs, NULL);
+    return blitter->egl_surface != EGL_NO_SURFACE;
+}
+
 static void
 get_aspect_correct_coords(int viewport[2], int plane[2], int rotation, GLfloat vert[4][4], GLfloat scale[2])
 {
@@ -180,20 +240,246 @@ void mat_ortho(float left, float right, float bottom, float top, float Result[4]
     Result[3][3] = 1.0f;
 }
 
+#ifndef GL_PROGRAM_BINARY_LENGTH_OES
+#define GL_PROGRAM_BINARY_LENGTH_OES 0x8741
+#endif
+#ifndef GL_SHADING_LANGUAGE_VERSION
+#define GL_SHADING_LANGUAGE_VERSION 0x8B8C
+#endif
+
+// Shader cache file: this header, the key it was saved under, then the
+// program binary.
+#define KMSDRM_BLITTER_CACHE_MAGIC 0x42444d4b /* "KMDB" */
+#define KMSDRM_BLITTER_CACHE_VERSION 2
+
+typedef struct KMSDRM_Blitter_CacheHeader {
+    Uint32 magic;
+    Uint32 version;
+    Uint32 key_length;
+    Uint32 format;
+    Uint32 length;
+} KMSDRM_Blitter_CacheHeader;
+
+// The cache key covers everything a program binary depends on: the driver
+// (vendor, renderer, version and extension strings) and the exact sources,
+// which bake in the rotation and scaler selection. It's all stored in the
+// file and compared on load, its CRC only names the file.
+static char *
+KMSDRM_Blitter_CacheKey(KMSDRM_Blitter *blitter, const GLchar *sources[2], size_t *key_length)
+{
+    const char *strings[7];
+    size_t lengths[SDL_arraysize(strings)];
+    size_t total = 0;
+    char *key;
+    int i;
+
+    strings[0] = (const char *)blitter->glGetString(GL_VENDOR);
+    strings[1] = (const char *)blitter->glGetString(GL_RENDERER);
+    strings[2] = (const char *)blitter->glGetString(GL_VERSION);
+    strings[3] = (const char *)blitter->glGetString(GL_SHADING_LANGUAGE_VERSION);
+    strings[4] = (const char *)blitter->glGetString(GL_EXTENSIONS);
+    strings[5] = sources[0];
+    strings[6] = sources[1];
+
+    for (i = 0; i < SDL_arraysize(strings); i++) {
+        // Keep the terminators, so strings can't run into each other
+        lengths[i] = (strings[i] ? SDL_strlen(strings[i]) : 0) + 1;
+        total += lengths[i];
+    }
+
+    key = SDL_malloc(total);
+    if (!key) {
+        return NULL;
+    }
+
+    total = 0;
+    for (i = 0; i < SDL_arraysize(strings); i++) {
+        SDL_memcpy(key + total, strings[i] ? strings[i] : "", lengths[i]);
+        total += lengths[i];
+    }
+
+    *key_length = total;
+    return key;
+}
+
+static char *
+KMSDRM_Blitter_CachePath(const char *key, size_t key_length)
+{
+    char *pref_path, *path;
+    size_t len;
+
+    pref_path = SDL_GetPrefPath("SDL", "kmsdrm");
+    if (!pref_path) {
+        return NULL;
+    }
+
+    len = SDL_strlen(pref_path) + 32;
+    path = SDL_malloc(len);
+    if (path) {
+        SDL_snprintf(path, len, "%sblitter-%08x.bin", pref_path,
+                     (unsigned)SDL_crc32(0, key, key_length));
+    }
+
+    SDL_free(pref_path);
+    return path;
+}
+
+// Try to get the program from the cache. Returns 0 on any miss, including
+// a file saved under another key that has the same CRC, and a binary the
+// driver rejects, which are then overwritten after compiling.
+static int
+KMSDRM_Blitter_LoadProgram(KMSDRM_Blitter *blitter, const char *path, const char *key, size_t key_length)
+{
+    KMSDRM_Blitter_CacheHeader header;
+    SDL_RWops *rw;
+    char *saved_key = NULL;
+    void *binary = NULL;
+    GLint status = GL_FALSE;
+
+    rw = SDL_RWFromFile(path, "rb");
+    if (!rw) {
+        return 0;
+    }
+
+    if (SDL_RWread(rw, &header, sizeof(header), 1) == 1 &&
+        header.magic == KMSDRM_BLITTER_CACHE_MAGIC &&
+        header.version == KMSDRM_BLITTER_CACHE_VERSION &&
+        header.key_length == key_length && header.length > 0 &&
+        (saved_key = SDL_malloc(key_length)) != NULL &&
+        SDL_RWread(rw, saved_key, key_length, 1) == 1 &&
+        SDL_memcmp(saved_key, key, key_length) == 0 &&
+        (binary = SDL_malloc(header.length)) != NULL &&
+        SDL_RWread(rw, binary, header.length, 1) == 1) {
+        blitter->prog = blitter->glCreateProgram();
+        blitter->glProgramBinaryOES(blitter->prog, header.format, binary, header.length);
+        blitter->glGetProgramiv(blitter->prog, GL_LINK_STATUS, &status);
+
+        if (status != GL_TRUE) {
+            blitter->glDeleteProgram(blitter->prog);
+            blitter->prog = 0;
+        }
+    }
+
+    SDL_free(binary);
+    SDL_free(saved_key);
+    SDL_RWclose(rw);
+
+    if (status == GL_TRUE) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Blitter program loaded from %s", path);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Save the linked program. Written to a temporary file and renamed into
+// place, so concurrent runs never see a torn file.
+static void
+KMSDRM_Blitter_SaveProgram(KMSDRM_Blitter *blitter, const char *path, const char *key, size_t key_length)
+{
+    KMSDRM_Blitter_CacheHeader header;
+    SDL_RWops *rw;
+    void *binary;
+    char *tmp_path;
+    size_t len;
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    int ok;
+
+    blitter->glGetProgramiv(blitter->prog, GL_PROGRAM_BINARY_LENGTH_OES, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    binary = SDL_malloc(length);
+    if (!binary) {
+        return;
+    }
+
+    blitter->glGetProgramBinaryOES(blitter->prog, length, &written, &format, binary);
+    if (written <= 0) {
+        SDL_free(binary);
+        return;
+    }
+
+    len = SDL_strlen(path) + 16;
+    tmp_path = SDL_malloc(len);
+    if (!tmp_path) {
+        SDL_free(binary);
+        return;
+    }
+    SDL_snprintf(tmp_path, len, "%s.%d", path, (int)getpid());
+
+    header.magic = KMSDRM_BLITTER_CACHE_MAGIC;
+    header.version = KMSDRM_BLITTER_CACHE_VERSION;
+    header.key_length = (Uint32)key_length;
+    header.format = format;
+    header.length = written;
+
+    rw = SDL_RWFromFile(tmp_path, "wb");
+    if (rw) {
+        ok = SDL_RWwrite(rw, &header, sizeof(header), 1) == 1 &&
+             SDL_RWwrite(rw, key, key_length, 1) == 1 &&
+             SDL_RWwrite(rw, binary, written, 1) == 1;
+        ok = (SDL_RWclose(rw) == 0) && ok;
+
+        if (ok && rename(tmp_path, path) == 0) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Blitter program saved to %s", path);
+        } else {
+            SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Could not save blitter program to %s", path);
+            remove(tmp_path);
+        }
+    }
+
+    SDL_free(tmp_path);
+    SDL_free(binary);
+}
+
 #define fourcc_code(a, b, c, d) \
       ((uint32_t)(a) \
     | ((uint32_t)(b) << 8) \
     | ((uint32_t)(c) << 16) \
     | ((uint32_t)(d) << 24))
 
+/* Projection, aspect corrected quad and scaler uniforms for the current
+   viewport and plane sizes. Needs the blitter's context current. */
+static void
+KMSDRM_Blitter_SetupViewport(KMSDRM_Blitter *blitter)
+{
+    float scale[2];
+
+    /* Prepare projection and aspect corrected bounds */
+    mat_ortho(0, blitter->viewport_width, 0, blitter->viewport_height, blitter->mat_projection);
+    get_aspect_correct_coords(
+        (int [2]){blitter->viewport_width, blitter->viewport_height},
+        (int [2]){blitter->plane_width, blitter->plane_height},
+        blitter->rotation,
+        blitter->vert_buffer_data,
+        scale
+    );
+
+    /* Setup viewport, projection, scale, texture size */
+    blitter->glViewport(0, 0, blitter->viewport_width, blitter->viewport_height);
+    blitter->glUniformMatrix4fv(blitter->loc_uProj, 1, 0, (GLfloat*)blitter->mat_projection);
+    blitter->glUniform2f(blitter->loc_uScale, scale[0], scale[1]);
+    blitter->glUniform2f(blitter->loc_uTexSize, blitter->plane_width, blitter->plane_height);
+
+    /* Populate buffers */
+    blitter->glBindBuffer(GL_ARRAY_BUFFER, blitter->vbo);
+    blitter->glBufferData(GL_ARRAY_BUFFER, sizeof(blitter->vert_buffer_data), blitter->vert_buffer_data, GL_STATIC_DRAW);
+}
+
 int
-KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rotation)
+KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, int rotation)
 {
     int fail = 0;
     char *use_hq_scaler;
     GLchar msg[2048] = {}, blit_vert[2048] = {};
     const GLchar *sources[2] = { blit_vert, blit_frag_standard };
-    float scale[2];
+    char *cache_path = NULL;
+    char *cache_key = NULL;
+    size_t cache_key_length = 0;
 
     if ((use_hq_scaler = SDL_getenv("SDL_KMSDRM_HQ_SCALER")) != NULL && *use_hq_scaler != '0') {
         switch (*use_hq_scaler) {
@@ -233,9 +519,37 @@ KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rota
         return 0;
     }
 
-    blitter->egl_surface = SDL_EGL_CreateSurface(_this, nw);
-    if (blitter->egl_surface == EGL_NO_SURFACE) {
-        SDL_EGL_SetError("No surface pilfered from backend, failure.", "SDL_EGL_CreateSurface");
+    // For partial redraws, optional
+    blitter->has_buffer_age = SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_EXT_buffer_age");
+    if (SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_KHR_swap_buffers_with_damage")) {
+        blitter->eglSwapBuffersWithDamage = blitter->eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    } else if (SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_EXT_swap_buffers_with_damage")) {
+        blitter->eglSwapBuffersWithDamage = blitter->eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
+    blitter->num_damage_history = -1;
+
+    // Explicit sync was settled on at window creation, only the FD export is ours to find
+    if (((SDL_VideoData *)_this->driverdata)->explicit_sync) {
+        blitter->eglDupNativeFenceFDANDROID = blitter->eglGetProcAddress("eglDupNativeFenceFDANDROID");
+        blitter->explicit_sync = (blitter->eglDupNativeFenceFDANDROID != NULL);
+    }
+
+    // Scan out in the window's format, falling back to ARGB8888, and to
+    // SDL's own config for drivers that don't report native visuals.
+    blitter->egl_display = _this->egl_data->egl_display;
+    blitter->format = ((SDL_WindowData *)blitter->window->driverdata)->scanout_format;
+    blitter->config = KMSDRM_Blitter_ChooseConfig(blitter, blitter->format);
+    if (!blitter->config && blitter->format != GBM_FORMAT_ARGB8888) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "No EGL config for the blitter's scanout format, using ARGB8888");
+        blitter->format = GBM_FORMAT_ARGB8888;
+        blitter->config = KMSDRM_Blitter_ChooseConfig(blitter, blitter->format);
+    }
+    if (!blitter->config) {
+        blitter->config = _this->egl_data->egl_config;
+    }
+
+    if (!KMSDRM_Blitter_CreateSurface(_this, blitter, blitter->viewport_width, blitter->viewport_height)) {
+        SDL_EGL_SetError("Failed to create blitter surface", "eglCreateWindowSurface");
         return 0;
     }
 
@@ -266,6 +580,24 @@ KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rota
         (use_hq_scaler) ? "vTexCoord = vTexCoord;"
                         : "vTexCoord = vTexCoord / uTexSize;");
 
+    /* Skip compilation if the driver can give us the program from a previous run */
+    if (SDL_GetHintBoolean(SDL_HINT_KMSDRM_SHADER_CACHE, SDL_TRUE) &&
+        SDL_strstr((const char *)blitter->glGetString(GL_EXTENSIONS), "GL_OES_get_program_binary")) {
+        blitter->glGetProgramBinaryOES = blitter->eglGetProcAddress("glGetProgramBinaryOES");
+        blitter->glProgramBinaryOES = blitter->eglGetProcAddress("glProgramBinaryOES");
+
+        if (blitter->glGetProgramBinaryOES && blitter->glProgramBinaryOES) {
+            cache_key = KMSDRM_Blitter_CacheKey(blitter, sources, &cache_key_length);
+            if (cache_key) {
+                cache_path = KMSDRM_Blitter_CachePath(cache_key, cache_key_length);
+            }
+        }
+    }
+
+    if (cache_path && KMSDRM_Blitter_LoadProgram(blitter, cache_path, cache_key, cache_key_length)) {
+        goto linked;
+    }
+
     /* Compile vertex shader */
     blitter->vert = blitter->glCreateShader(GL_VERTEX_SHADER);
     blitter->glShaderSource(blitter->vert, 1, &sources[0], NULL);
@@ -285,6 +617,18 @@ KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rota
     blitter->glAttachShader(blitter->prog, blitter->frag);
 
     blitter->glLinkProgram(blitter->prog);
+
+    blitter->glGetProgramInfoLog(blitter->prog, sizeof(msg), NULL, msg);
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Blitter Program Info: %s\n", msg);
+
+    if (cache_path) {
+        KMSDRM_Blitter_SaveProgram(blitter, cache_path, cache_key, cache_key_length);
+    }
+
+linked:
+    SDL_free(cache_path);
+    SDL_free(cache_key);
+
     blitter->loc_aVertCoord = blitter->glGetAttribLocation(blitter->prog, "aVertCoord");
     blitter->loc_aTexCoord = blitter->glGetAttribLocation(blitter->prog, "aTexCoord");
     blitter->loc_uFBOtex = blitter->glGetUniformLocation(blitter->prog, "uFBOTex");
@@ -292,44 +636,88 @@ KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rota
     blitter->loc_uTexSize = blitter->glGetUniformLocation(blitter->prog, "uTexSize");
     blitter->loc_uScale = blitter->glGetUniformLocation(blitter->prog, "uScale");
 
-    blitter->glGetProgramInfoLog(blitter->prog, sizeof(msg), NULL, msg);
-    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Blitter Program Info: %s\n", msg);
-
     /* Setup programs */
     blitter->glUseProgram(blitter->prog);
     blitter->glUniform1i(blitter->loc_uFBOtex, 0);
 
-    /* Prepare projection and aspect corrected bounds */
-    mat_ortho(0, blitter->viewport_width, 0, blitter->viewport_height, blitter->mat_projection);
-    get_aspect_correct_coords(
-        (int [2]){blitter->viewport_width, blitter->viewport_height},
-        (int [2]){blitter->plane_width, blitter->plane_height},
-        rotation,
-        blitter->vert_buffer_data,
-        scale
-    );
-
-    /* Setup viewport, projection, scale, texture size */
-    blitter->glViewport(0, 0, blitter->viewport_width, blitter->viewport_height);
-    blitter->glUniformMatrix4fv(blitter->loc_uProj, 1, 0, (GLfloat*)blitter->mat_projection);
-    blitter->glUniform2f(blitter->loc_uScale, scale[0], scale[1]);
-    blitter->glUniform2f(blitter->loc_uTexSize, blitter->plane_width, blitter->plane_height);
-
     /* Generate buffers */
     blitter->glGenBuffers(1, &blitter->vbo);
     blitter->glGenVertexArraysOES(1, &blitter->vao);
 
-    /* Populate buffers */
+    /* Setup attributes */
     blitter->glBindVertexArrayOES(blitter->vao);
     blitter->glBindBuffer(GL_ARRAY_BUFFER, blitter->vbo);
     blitter->glEnableVertexAttribArray(blitter->loc_aVertCoord);
     blitter->glEnableVertexAttribArray(blitter->loc_aTexCoord);
     blitter->glVertexAttribPointer(blitter->loc_aVertCoord, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(0 * sizeof(float)));
     blitter->glVertexAttribPointer(blitter->loc_aTexCoord, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    blitter->glBufferData(GL_ARRAY_BUFFER, sizeof(blitter->vert_buffer_data), blitter->vert_buffer_data, GL_STATIC_DRAW);
+
+    KMSDRM_Blitter_SetupViewport(blitter);
     return 1;
 }
 
+/* Thread side of a resize: called with the sizes KMSDRM_BlitterResume()
+   was given, once the app's old surfaces are gone. The context, shaders
+   and imports are kept, only our GBM surface is recreated, and only if
+   the mode size changed. */
+static void
+KMSDRM_Blitter_Reconfigure(_THIS, KMSDRM_Blitter *blitter, SDL_WindowData *windata,
+                           GLsizei viewport_width, GLsizei viewport_height,
+                           GLint plane_width, GLint plane_height)
+{
+    /* The CRTC went back to its original buffer when the app's surfaces
+       were destroyed, so ours are off screen once the last flip is in.
+       Dropping them also makes the next frame do the modeset. */
+    if (!KMSDRM_WaitPageflip(_this, windata)) {
+        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Wait for previous pageflip failed");
+    }
+
+    if (blitter->gs) {
+        KMSDRM_CaptureForget(&windata->capture, blitter->gs);
+    }
+
+    if (blitter->next_bo) {
+        KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->next_bo);
+        blitter->next_bo = NULL;
+    }
+
+    if (blitter->bo) {
+        KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->bo);
+        blitter->bo = NULL;
+    }
+
+    if (viewport_width != blitter->viewport_width || viewport_height != blitter->viewport_height ||
+        blitter->egl_surface == EGL_NO_SURFACE) {
+        blitter->eglMakeCurrent(blitter->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, blitter->gl_context);
+
+        if (blitter->egl_surface != EGL_NO_SURFACE) {
+            blitter->eglDestroySurface(blitter->egl_display, blitter->egl_surface);
+            blitter->egl_surface = EGL_NO_SURFACE;
+        }
+
+        if (blitter->gs) {
+            KMSDRM_gbm_surface_destroy(blitter->gs);
+        }
+
+        if (!KMSDRM_Blitter_CreateSurface(_this, blitter, viewport_width, viewport_height) ||
+            !blitter->eglMakeCurrent(blitter->egl_display, blitter->egl_surface,
+                                     blitter->egl_surface, blitter->gl_context)) {
+            SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Failed to resize blitter surface to %dx%d",
+                         (int)viewport_width, (int)viewport_height);
+            return;
+        }
+    }
+
+    blitter->viewport_width = viewport_width;
+    blitter->viewport_height = viewport_height;
+    blitter->plane_width = plane_width;
+    blitter->plane_height = plane_height;
+    KMSDRM_Blitter_SetupViewport(blitter);
+
+    // The quad may have moved, nothing in the back buffers can be reused
+    blitter->num_damage_history = -1;
+}
+
 void
 KMSDRM_Blitter_Blit(_THIS, KMSDRM_Blitter *blitter, GLuint texture)
 {
@@ -338,64 +726,311 @@ KMSDRM_Blitter_Blit(_THIS, KMSDRM_Blitter *blitter, GLuint texture)
     blitter->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
 
+// Where an app frame's damage lands on our surface, as a single rect in
+// top-left origin pixels. It's the shaders' mapping: the quad from
+// get_aspect_correct_coords(), with the texture rotated counter-clockwise.
+// Filtering spreads texels over their neighbours, hence the margin.
+// Returns SDL_FALSE if the whole surface has to be redrawn.
+static SDL_bool
+KMSDRM_Blitter_MapDamage(KMSDRM_Blitter *blitter, const KMSDRM_Damage *damage, SDL_Rect *out)
+{
+    const SDL_Rect bounds = { 0, 0, blitter->viewport_width, blitter->viewport_height };
+    SDL_Rect app = { 0, 0, 0, 0 };
+    float u0, u1, v0, v1, x0, x1, y0, y1;
+    float quad_x, quad_y, quad_w, quad_h;
+    int i, margin;
+
+    if (!damage->partial || blitter->plane_width <= 0 || blitter->plane_height <= 0) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < damage->num_rects; i++) {
+        SDL_UnionRect(&app, &damage->rects[i], &app);
+    }
+
+    u0 = (float)app.x / blitter->plane_width;
+    u1 = (float)(app.x + app.w) / blitter->plane_width;
+    v0 = (float)app.y / blitter->plane_height;
+    v1 = (float)(app.y + app.h) / blitter->plane_height;
+
+    switch (blitter->rotation) {
+        case 1: x0 = v0; x1 = v1; y0 = 1.0f - u1; y1 = 1.0f - u0; break;
+        case 2: x0 = 1.0f - u1; x1 = 1.0f - u0; y0 = 1.0f - v1; y1 = 1.0f - v0; break;
+        case 3: x0 = 1.0f - v1; x1 = 1.0f - v0; y0 = u0; y1 = u1; break;
+        default: x0 = u0; x1 = u1; y0 = v0; y1 = v1; break;
+    }
+
+    // The quad's corners are in bottom-left origin pixels
+    quad_x = blitter->vert_buffer_data[0][0];
+    quad_w = blitter->vert_buffer_data[3][0] - quad_x;
+    quad_h = blitter->vert_buffer_data[3][1] - blitter->vert_buffer_data[0][1];
+    quad_y = blitter->viewport_height - blitter->vert_buffer_data[3][1];
+
+    margin = (int)SDL_ceilf(SDL_max(quad_w, quad_h) / SDL_min(blitter->plane_width, blitter->plane_height)) + 1;
+    out->x = (int)SDL_floorf(quad_x + x0 * quad_w) - margin;
+    out->y = (int)SDL_floorf(quad_y + y0 * quad_h) - margin;
+    out->w = (int)SDL_ceilf(quad_x + x1 * quad_w) + margin - out->x;
+    out->h = (int)SDL_ceilf(quad_y + y1 * quad_h) + margin - out->y;
+
+    if (SDL_RectEmpty(&app) || !SDL_IntersectRect(out, &bounds, out)) {
+        SDL_zerop(out);
+    }
+
+    return SDL_TRUE;
+}
+
+// What has to be drawn into the back buffer we're about to render to: this
+// frame's damage, plus whatever changed since that buffer was last drawn,
+// going by its age. Also records the frame's damage for the next ones.
+// Returns SDL_FALSE if that's the whole surface.
+static SDL_bool
+KMSDRM_Blitter_GetRepaint(KMSDRM_Blitter *blitter, const SDL_Rect *damage, SDL_Rect *repaint)
+{
+    EGLint age = 0;
+    SDL_bool partial = SDL_FALSE;
+    int i;
+
+    if (damage && blitter->has_buffer_age &&
+        blitter->eglQuerySurface(blitter->egl_display, blitter->egl_surface, EGL_BUFFER_AGE_EXT, &age) &&
+        age > 0 && age <= blitter->num_damage_history + 1) {
+        *repaint = *damage;
+        for (i = 0; i < age - 1; i++) {
+            SDL_UnionRect(repaint, &blitter->damage_history[i], repaint);
+        }
+        partial = SDL_TRUE;
+    }
+
+    if (damage) {
+        SDL_memmove(&blitter->damage_history[1], &blitter->damage_history[0],
+                    sizeof(blitter->damage_history) - sizeof(blitter->damage_history[0]));
+        blitter->damage_history[0] = *damage;
+        blitter->num_damage_history = SDL_min(SDL_max(blitter->num_damage_history, 0) + 1,
+                                              KMSDRM_BLITTER_DAMAGE_HISTORY);
+    } else {
+        // A full frame: every buffer older than it is as good as new
+        blitter->num_damage_history = 0;
+    }
+
+    return partial;
+}
+
+// Make our draw wait for the app's frame. With explicit sync the GPU does
+// the waiting, and when the app's rendering ended isn't known; otherwise
+// this thread sleeps until it's done.
+static SDL_bool
+KMSDRM_Blitter_WaitFence(KMSDRM_Blitter *blitter, KMSDRM_FrameTimes *timing, KMSDRM_Blitter_Plane *plane)
+{
+    if (blitter->explicit_sync) {
+        return blitter->eglWaitSyncKHR(blitter->egl_display, plane->fence, 0) == EGL_TRUE;
+    }
+
+    if (!blitter->eglClientWaitSyncKHR(blitter->egl_display, plane->fence,
+                                       EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, EGL_FOREVER_NV)) {
+        return SDL_FALSE;
+    }
+
+    KMSDRM_TimingFence(timing, KMSDRM_TimingNow());
+    return SDL_TRUE;
+}
+
+static EGLBoolean
+KMSDRM_Blitter_SwapBuffers(KMSDRM_Blitter *blitter, const SDL_Rect *damage)
+{
+    EGLint rect[4];
+
+    if (damage && !SDL_RectEmpty(damage) && blitter->eglSwapBuffersWithDamage) {
+        // EGL wants it with a bottom-left origin
+        rect[0] = damage->x;
+        rect[1] = blitter->viewport_height - damage->y - damage->h;
+        rect[2] = damage->w;
+        rect[3] = damage->h;
+        return blitter->eglSwapBuffersWithDamage(blitter->egl_display, blitter->egl_surface, rect, 1);
+    }
+
+    return blitter->eglSwapBuffers(blitter->egl_display, blitter->egl_surface);
+}
+
+// EGL_EXT_image_dma_buf_import_modifiers, missing from older headers
+#ifndef EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT
+#define EGL_DMA_BUF_PLANE3_FD_EXT          0x3440
+#define EGL_DMA_BUF_PLANE3_OFFSET_EXT      0x3441
+#define EGL_DMA_BUF_PLANE3_PITCH_EXT       0x3442
+#define EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT 0x3443
+#define EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT 0x3444
+#define EGL_DMA_BUF_PLANE1_MODIFIER_LO_EXT 0x3445
+#define EGL_DMA_BUF_PLANE1_MODIFIER_HI_EXT 0x3446
+#define EGL_DMA_BUF_PLANE2_MODIFIER_LO_EXT 0x3447
+#define EGL_DMA_BUF_PLANE2_MODIFIER_HI_EXT 0x3448
+#define EGL_DMA_BUF_PLANE3_MODIFIER_LO_EXT 0x3449
+#define EGL_DMA_BUF_PLANE3_MODIFIER_HI_EXT 0x344A
+#endif
+
+// fd, offset, pitch, modifier lo and hi attributes for each dma-buf plane
+static const EGLint dmabuf_plane_attribs[4][5] = {
+    { EGL_DMA_BUF_PLANE0_FD_EXT, EGL_DMA_BUF_PLANE0_OFFSET_EXT, EGL_DMA_BUF_PLANE0_PITCH_EXT,
+      EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT },
+    { EGL_DMA_BUF_PLANE1_FD_EXT, EGL_DMA_BUF_PLANE1_OFFSET_EXT, EGL_DMA_BUF_PLANE1_PITCH_EXT,
+      EGL_DMA_BUF_PLANE1_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE1_MODIFIER_HI_EXT },
+    { EGL_DMA_BUF_PLANE2_FD_EXT, EGL_DMA_BUF_PLANE2_OFFSET_EXT, EGL_DMA_BUF_PLANE2_PITCH_EXT,
+      EGL_DMA_BUF_PLANE2_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE2_MODIFIER_HI_EXT },
+    { EGL_DMA_BUF_PLANE3_FD_EXT, EGL_DMA_BUF_PLANE3_OFFSET_EXT, EGL_DMA_BUF_PLANE3_PITCH_EXT,
+      EGL_DMA_BUF_PLANE3_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE3_MODIFIER_HI_EXT },
+};
+
+/* Called with the blitter mutex held. */
+static void
+KMSDRM_Blitter_FreeImport(KMSDRM_Blitter *blitter, KMSDRM_Blitter_Import *import)
+{
+    if (import->info) {
+        import->info->blitter = NULL;
+        import->info = NULL;
+    }
+
+    if (import->texture) {
+        blitter->glDeleteTextures(1, &import->texture);
+        import->texture = 0;
+    }
+
+    if (import->image != EGL_NO_IMAGE_KHR) {
+        blitter->eglDestroyImageKHR(blitter->egl_display, import->image);
+        import->image = EGL_NO_IMAGE_KHR;
+    }
+}
+
+static KMSDRM_Blitter_Import *
+KMSDRM_Blitter_NewImport(KMSDRM_Blitter *blitter)
+{
+    KMSDRM_Blitter_Import *import = NULL;
+    int i;
+
+    SDL_LockMutex(blitter->mutex);
+
+    /* Free the imports of BOs that are gone, and take the first free slot */
+    for (i = 0; i < KMSDRM_BLITTER_MAX_IMPORTS; i++) {
+        if (!blitter->imports[i].info) {
+            KMSDRM_Blitter_FreeImport(blitter, &blitter->imports[i]);
+            if (!import) {
+                import = &blitter->imports[i];
+            }
+        }
+    }
+
+    /* All taken, evict the oldest: likely from a surface that's no longer used. */
+    if (!import) {
+        import = &blitter->imports[blitter->next_import];
+        blitter->next_import = (blitter->next_import + 1) % KMSDRM_BLITTER_MAX_IMPORTS;
+        KMSDRM_Blitter_FreeImport(blitter, import);
+    }
+
+    SDL_UnlockMutex(blitter->mutex);
+
+    return import;
+}
+
 void
 KMSDRM_Blitter_GetTexture(_THIS, KMSDRM_Blitter *blitter, KMSDRM_Blitter_Plane *plane)
 {
-    int fd = KMSDRM_gbm_bo_get_fd(plane->bo);
-    EGLint attribute_list[] = {
-        EGL_WIDTH, KMSDRM_gbm_bo_get_width(plane->bo),
-        EGL_HEIGHT, KMSDRM_gbm_bo_get_height(plane->bo),
-        EGL_LINUX_DRM_FOURCC_EXT, GBM_FORMAT_ARGB8888,
-        EGL_DMA_BUF_PLANE0_OFFSET_EXT, 0,
-        EGL_DMA_BUF_PLANE0_PITCH_EXT, KMSDRM_gbm_bo_get_stride(plane->bo),
-        EGL_DMA_BUF_PLANE0_FD_EXT, fd,
-        EGL_NONE
-    };
+    KMSDRM_FBInfo *info = KMSDRM_GetBOInfo(_this, plane->bo);
+    KMSDRM_Blitter_Import *import;
+    EGLImageKHR image;
+    int fd;
+
+    plane->texture = 0;
+
+    if (!info) {
+        return;
+    }
+
+    /* Already imported, nothing else to do */
+    if (info->blitter == blitter) {
+        plane->texture = blitter->imports[info->import_slot].texture;
+        return;
+    }
 
+    fd = KMSDRM_gbm_bo_get_fd(plane->bo);
     if (fd < 0) {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Failed to get bo handle! (%d)", fd);
         return;
     }
 
-    plane->image = blitter->eglCreateImageKHR(blitter->egl_display,
-        EGL_NO_CONTEXT,
-        EGL_LINUX_DMA_BUF_EXT,
-        (EGLClientBuffer)NULL,
-        attribute_list);
-    if (plane->image == EGL_NO_IMAGE_KHR) {
+    {
+        EGLint attribute_list[64];
+        int attr = 0;
+
+        attribute_list[attr++] = EGL_WIDTH;
+        attribute_list[attr++] = KMSDRM_gbm_bo_get_width(plane->bo);
+        attribute_list[attr++] = EGL_HEIGHT;
+        attribute_list[attr++] = KMSDRM_gbm_bo_get_height(plane->bo);
+        attribute_list[attr++] = EGL_LINUX_DRM_FOURCC_EXT;
+        attribute_list[attr++] = KMSDRM_gbm_bo_get_format(plane->bo);
+
+        if (KMSDRM_gbm_bo_get_modifier && KMSDRM_gbm_bo_get_plane_count &&
+            KMSDRM_gbm_bo_get_stride_for_plane && KMSDRM_gbm_bo_get_offset &&
+            KMSDRM_gbm_bo_get_modifier(plane->bo) != DRM_FORMAT_MOD_INVALID &&
+            SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_EXT_image_dma_buf_import_modifiers")) {
+            // Tiled or compressed: every plane lives in the same dma-buf,
+            // at its own offset, and they all share the modifier.
+            uint64_t modifier = KMSDRM_gbm_bo_get_modifier(plane->bo);
+            int i, num_planes = SDL_min(KMSDRM_gbm_bo_get_plane_count(plane->bo), 4);
+
+            for (i = 0; i < num_planes; i++) {
+                attribute_list[attr++] = dmabuf_plane_attribs[i][0];
+                attribute_list[attr++] = fd;
+                attribute_list[attr++] = dmabuf_plane_attribs[i][1];
+                attribute_list[attr++] = KMSDRM_gbm_bo_get_offset(plane->bo, i);
+                attribute_list[attr++] = dmabuf_plane_attribs[i][2];
+                attribute_list[attr++] = KMSDRM_gbm_bo_get_stride_for_plane(plane->bo, i);
+                attribute_list[attr++] = dmabuf_plane_attribs[i][3];
+                attribute_list[attr++] = (EGLint)(modifier & 0xffffffff);
+                attribute_list[attr++] = dmabuf_plane_attribs[i][4];
+                attribute_list[attr++] = (EGLint)(modifier >> 32);
+            }
+        } else {
+            attribute_list[attr++] = EGL_DMA_BUF_PLANE0_FD_EXT;
+            attribute_list[attr++] = fd;
+            attribute_list[attr++] = EGL_DMA_BUF_PLANE0_OFFSET_EXT;
+            attribute_list[attr++] = 0;
+            attribute_list[attr++] = EGL_DMA_BUF_PLANE0_PITCH_EXT;
+            attribute_list[attr++] = KMSDRM_gbm_bo_get_stride(plane->bo);
+        }
+
+        attribute_list[attr++] = EGL_NONE;
+
+        image = blitter->eglCreateImageKHR(blitter->egl_display,
+            EGL_NO_CONTEXT,
+            EGL_LINUX_DMA_BUF_EXT,
+            (EGLClientBuffer)NULL,
+            attribute_list);
+    }
+
+    /* The image holds its own reference to the dma-buf */
+    close(fd);
+
+    if (image == EGL_NO_IMAGE_KHR) {
         SDL_EGL_SetError("Failed to create Blitter EGL Image", "eglCreateImageKHR");
         return;
     }
 
-    blitter->glGenTextures(1, &plane->texture);
+    import = KMSDRM_Blitter_NewImport(blitter);
+    import->image = image;
+
+    blitter->glGenTextures(1, &import->texture);
     blitter->glActiveTexture(GL_TEXTURE0);
-    blitter->glBindTexture(GL_TEXTURE_2D, plane->texture);
+    blitter->glBindTexture(GL_TEXTURE_2D, import->texture);
     blitter->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     blitter->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     blitter->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     blitter->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    blitter->glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, plane->image);
-    close(fd);
-}
+    blitter->glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, import->image);
 
-void
-KMSDRM_Blitter_FreeTexture(_THIS, KMSDRM_Blitter *blitter, KMSDRM_Blitter_Plane *plane)
-{
-    if (!plane->bo)
-        return;
+    SDL_LockMutex(blitter->mutex);
+    import->info = info;
+    info->blitter = blitter;
+    info->import_slot = (int)(import - blitter->imports);
+    SDL_UnlockMutex(blitter->mutex);
 
-    blitter->glDeleteTextures(1, &plane->texture);
-    blitter->eglDestroyImageKHR(blitter->egl_display, plane->image);
-    /*
-     * It might be tempting to call release_buffer here, but remember that
-     * this resource does not belong to the blitter, and is managed by SwapBuffers.
-     * //KMSDRM_gbm_surface_release_buffer(blitter->gs, plane->bo);
-     */
-
-    plane->bo = NULL;
-    plane->image = EGL_NO_IMAGE_KHR;
-    plane->texture = -1;
+    plane->texture = import->texture;
 }
 
 int KMSDRM_BlitterThread(void *data)
@@ -411,17 +1046,8 @@ int KMSDRM_BlitterThread(void *data)
     SDL_VideoDisplay *display = SDL_GetDisplayForWindow(window);
     SDL_DisplayData *dispdata = (SDL_DisplayData *)display->driverdata;
 
-    /* Initialize gbm surface */
-    blitter->gs = KMSDRM_gbm_surface_create(viddata->gbm_dev,
-                      blitter->viewport_width, blitter->viewport_height,
-                      GBM_FORMAT_ARGB8888, GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING); 
-    if (!blitter->gs) {
-        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Failed to initialize blitter gbm surface");
-        SDL_Quit();
-    }
-
-    /* Initialize blitter */
-    if (!KMSDRM_InitBlitter(_this, blitter, (NativeWindowType)blitter->gs, blitter->rotation))
+    /* Initialize blitter and its gbm surface */
+    if (!KMSDRM_InitBlitter(_this, blitter, blitter->rotation))
     {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Failed to initialize blitter thread");
         SDL_Quit();
@@ -429,31 +1055,72 @@ int KMSDRM_BlitterThread(void *data)
 
     /* Signal triplebuf available */
     SDL_LockMutex(blitter->mutex);
-    SDL_CondSignal(blitter->cond);
+    blitter->thread_ready = 1;
+    SDL_CondBroadcast(blitter->cond);
 
     for (;;) {
-        SDL_CondWait(blitter->cond, blitter->mutex);        
+        SDL_Rect damage, repaint;
+        SDL_bool partial;
+        KMSDRM_Damage fb_damage;
+        EGLSyncKHR out_fence;
+        int fence_fd;
+
+        while (!blitter->thread_stop && !blitter->reconfigure &&
+               (blitter->suspended || !blitter->pending.bo)) {
+            SDL_CondWait(blitter->cond, blitter->mutex);
+        }
 
         if (blitter->thread_stop)
             break;
 
+        if (blitter->reconfigure) {
+            GLsizei viewport_width = blitter->new_viewport_width;
+            GLsizei viewport_height = blitter->new_viewport_height;
+            GLint plane_width = blitter->new_plane_width;
+            GLint plane_height = blitter->new_plane_height;
+
+            blitter->reconfigure = 0;
+            blitter->thread_busy = 1;
+            SDL_UnlockMutex(blitter->mutex);
+
+            KMSDRM_Blitter_Reconfigure(_this, blitter, windata, viewport_width, viewport_height,
+                                       plane_width, plane_height);
+
+            SDL_LockMutex(blitter->mutex);
+            blitter->thread_busy = 0;
+            SDL_CondBroadcast(blitter->cond);
+            continue;
+        }
+
+        /* Take the newest frame and free the slot, so SwapWindow doesn't
+           have to wait for us while we blit and flip. */
+        current = &blitter->current;
+        *current = blitter->pending;
+        blitter->pending.bo = NULL;
+        blitter->pending.fence = EGL_NO_SYNC_KHR;
+        blitter->thread_busy = 1;
+        SDL_CondBroadcast(blitter->cond);
+        SDL_UnlockMutex(blitter->mutex);
+
         if (prevSwapInterval != _this->egl_data->egl_swapinterval) {
-            blitter->eglSwapInterval(blitter->egl_display, _this->egl_data->egl_swapinterval);
+            /* Mailbox mode (-1) only means the app doesn't wait: our own
+               frames are still synced to vblank. */
             prevSwapInterval = _this->egl_data->egl_swapinterval;
+            blitter->eglSwapInterval(blitter->egl_display, (prevSwapInterval < 0) ? 1 : prevSwapInterval);
         }
 
-        /* Release previous texture and acquire current */
-        KMSDRM_Blitter_FreeTexture(_this, blitter, &blitter->planes[!blitter->next]);
-        current = &blitter->planes[blitter->next];
-        blitter->next ^= 1;
-
         /* wait for fence and flip display */
-        if (blitter->eglClientWaitSyncKHR(
-            blitter->egl_display,
-            current->fence, 
-            EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, 
-            EGL_FOREVER_NV))
+        KMSDRM_TimingSwap(&windata->timing, current->swap_ns);
+        if (blitter->egl_surface != EGL_NO_SURFACE && KMSDRM_Blitter_WaitFence(blitter, &windata->timing, current))
         {
+            /* Only redraw what changed, if the back buffer still has the rest */
+            partial = KMSDRM_Blitter_MapDamage(blitter, &current->damage, &damage);
+            if (KMSDRM_Blitter_GetRepaint(blitter, partial ? &damage : NULL, &repaint)) {
+                blitter->glEnable(GL_SCISSOR_TEST);
+                blitter->glScissor(repaint.x, blitter->viewport_height - repaint.y - repaint.h,
+                                   repaint.w, repaint.h);
+            }
+
             /* Discarding previous data... */
             blitter->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
             blitter->glClearColor(0.0, 1.0, 0.0, 1.0);
@@ -461,57 +1128,109 @@ int KMSDRM_BlitterThread(void *data)
             /* Perform blitting */
             KMSDRM_Blitter_GetTexture(_this, blitter, current);
             KMSDRM_Blitter_Blit(_this, blitter, current->texture);
+            blitter->glDisable(GL_SCISSOR_TEST);
 
             /* Wait for confirmation that the next front buffer has been flipped, at which
             point the previous front buffer can be released */
             if (!KMSDRM_WaitPageflip(_this, windata)) {
                 SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Wait for previous pageflip failed");
-                return 0;
             }
 
-            /* Release the previous front buffer */
+            /* Release the previous front buffer, unless it's retained for capture,
+            and give back the retained ones that aren't anymore. */
             if (blitter->bo) {
-                KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->bo);
+                KMSDRM_CaptureReleaseBuffer(&windata->capture, blitter->gs, blitter->bo);
                 blitter->bo = NULL;
             }
+            KMSDRM_CaptureCollect(&windata->capture, blitter->gs);
 
             blitter->bo = blitter->next_bo;
+            blitter->next_bo = NULL;
+
+            /* The kernel can wait for our draw itself */
+            out_fence = EGL_NO_SYNC_KHR;
+            if (blitter->explicit_sync && KMSDRM_AtomicHasInFence(dispdata)) {
+                out_fence = blitter->eglCreateSyncKHR(blitter->egl_display, EGL_SYNC_NATIVE_FENCE_ANDROID, NULL);
+            }
 
             /* Mark a buffer to becume the next front buffer.
             This won't happen until pagelip completes. */
-            if (!(blitter->eglSwapBuffers(blitter->egl_display, blitter->egl_surface))) {
+            if (!KMSDRM_Blitter_SwapBuffers(blitter, partial ? &damage : NULL)) {
                 SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "eglSwapBuffers failed");
-                return 0;
+                if (out_fence != EGL_NO_SYNC_KHR) {
+                    blitter->eglDestroySyncKHR(blitter->egl_display, out_fence);
+                }
+            } else {
+                /* Only flushed now, the FD can be had */
+                fence_fd = -1;
+                if (out_fence != EGL_NO_SYNC_KHR) {
+                    fence_fd = blitter->eglDupNativeFenceFDANDROID(blitter->egl_display, out_fence);
+                    blitter->eglDestroySyncKHR(blitter->egl_display, out_fence);
+                }
+
+                /* From the GBM surface, get the next BO to become the next front buffer,
+                and lock it so it can't be allocated as a back buffer (to prevent EGL
+                from drawing into it!) */
+                blitter->next_bo = KMSDRM_gbm_surface_lock_front_buffer(blitter->gs);
+                if (!blitter->next_bo) {
+                    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not lock front buffer on GBM surface");
+                    if (fence_fd >= 0) {
+                        close(fence_fd);
+                    }
+                } else {
+                    fb_damage.partial = partial;
+                    fb_damage.num_rects = 0;
+                    if (partial) {
+                        KMSDRM_AddDamage(&fb_damage, &damage, blitter->viewport_width, blitter->viewport_height);
+                    }
+                    KMSDRM_Post_gbm_bo(_this, windata, dispdata, viddata, blitter->bo, blitter->next_bo,
+                                       &fb_damage, fence_fd);
+                }
             }
-
-            /* From the GBM surface, get the next BO to become the next front buffer,
-            and lock it so it can't be allocated as a back buffer (to prevent EGL
-            from drawing into it!) */
-            blitter->next_bo = KMSDRM_gbm_surface_lock_front_buffer(blitter->gs);
-            if (!blitter->next_bo) {
-                SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not lock front buffer on GBM surface");
-                return 0;
-            }
-
-            KMSDRM_Post_gbm_bo(_this, windata, dispdata, viddata, blitter->bo, blitter->next_bo);
         }
         else
         {
             SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Sync %p failed.", current->fence);
         }
+
+        /* The app's BO has been drawn from, it can go back to its surface. */
+        blitter->eglDestroySyncKHR(blitter->egl_display, current->fence);
+        current->fence = EGL_NO_SYNC_KHR;
+
+        SDL_LockMutex(blitter->mutex);
+
+        /* GBM surfaces aren't ours to touch: if the app's thread hasn't
+           taken the retired BOs back in a while, wait for it to. It does
+           before each swap, and while it waits on us. If we're stopping,
+           KMSDRM_BlitterQuit() gives back current's BO itself. */
+        while (blitter->num_retired == SDL_arraysize(blitter->retired) && !blitter->thread_stop) {
+            SDL_CondBroadcast(blitter->cond);
+            SDL_CondWait(blitter->cond, blitter->mutex);
+        }
+        if (blitter->num_retired < SDL_arraysize(blitter->retired)) {
+            blitter->retired[blitter->num_retired++] = current->bo;
+            current->bo = NULL;
+        }
+        blitter->thread_busy = 0;
+        SDL_CondBroadcast(blitter->cond);
     }
 
-    for (i = 0; i < sizeof(blitter->planes) / sizeof(blitter->planes[0]); i++) {
-        KMSDRM_Blitter_FreeTexture(_this, blitter, &blitter->planes[!blitter->next]);
+    /* Imports go with our context; the BOs stay with the app's surface. */
+    for (i = 0; i < KMSDRM_BLITTER_MAX_IMPORTS; i++) {
+        KMSDRM_Blitter_FreeImport(blitter, &blitter->imports[i]);
     }
 
     /* Execution is done, teardown the allocated resources */
-    blitter->eglDestroySurface(blitter->egl_display, blitter->egl_surface);
+    blitter->eglMakeCurrent(blitter->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (blitter->egl_surface != EGL_NO_SURFACE) blitter->eglDestroySurface(blitter->egl_display, blitter->egl_surface);
     blitter->eglDestroyContext(blitter->egl_display, blitter->gl_context);
     blitter->eglReleaseThread();
-    if (blitter->next_bo) KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->next_bo);
-    if (blitter->bo) KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->bo);
-    KMSDRM_gbm_surface_destroy(blitter->gs);
+    if (blitter->gs) {
+        KMSDRM_CaptureForget(&((SDL_WindowData *)blitter->window->driverdata)->capture, blitter->gs);
+        if (blitter->next_bo) KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->next_bo);
+        if (blitter->bo) KMSDRM_gbm_surface_release_buffer(blitter->gs, blitter->bo);
+        KMSDRM_gbm_surface_destroy(blitter->gs);
+    }
 
     /* Signal thread done */
     SDL_UnlockMutex(blitter->mutex);
@@ -526,10 +1245,19 @@ void KMSDRM_BlitterInit(KMSDRM_Blitter *blitter)
     blitter->mutex = SDL_CreateMutex();
     blitter->cond = SDL_CreateCond();
     blitter->thread = SDL_CreateThread(KMSDRM_BlitterThread, "KMSDRM_BlitterThread", blitter);
+
+    /* Wait until the thread has its context and entry points */
+    SDL_LockMutex(blitter->mutex);
+    while (!blitter->thread_ready) {
+        SDL_CondWait(blitter->cond, blitter->mutex);
+    }
+    SDL_UnlockMutex(blitter->mutex);
 }
 
 void KMSDRM_BlitterQuit(KMSDRM_Blitter *blitter)
 {
+    struct gbm_surface *gs;
+
     /* Flag a stop request */
     SDL_LockMutex(blitter->mutex);
     blitter->thread_stop = 1;
@@ -541,8 +1269,136 @@ void KMSDRM_BlitterQuit(KMSDRM_Blitter *blitter)
     /* Wait and perform teardown */
     SDL_WaitThread(blitter->thread, NULL);
     blitter->thread = NULL;
+
+    /* Hand back whatever app BOs the thread still had. */
+    gs = ((SDL_WindowData *)blitter->window->driverdata)->gs;
+    KMSDRM_BlitterReleaseBuffers(blitter, gs);
+    if (blitter->pending.bo) {
+        KMSDRM_gbm_surface_release_buffer(gs, blitter->pending.bo);
+        blitter->eglDestroySyncKHR(blitter->egl_display, blitter->pending.fence);
+        blitter->pending.bo = NULL;
+    }
+    if (blitter->current.bo) {
+        KMSDRM_gbm_surface_release_buffer(gs, blitter->current.bo);
+        blitter->current.bo = NULL;
+    }
+
     SDL_DestroyMutex(blitter->mutex);
     SDL_DestroyCond(blitter->cond);
 }
 
+/* Give the retired BOs back to the app's surface, with the mutex held.
+   The thread may be waiting for room to retire its current one. */
+static void KMSDRM_BlitterGiveBack(KMSDRM_Blitter *blitter, struct gbm_surface *gs)
+{
+    int i;
+
+    if (blitter->num_retired > 0) {
+        for (i = 0; i < blitter->num_retired; i++) {
+            KMSDRM_gbm_surface_release_buffer(gs, blitter->retired[i]);
+        }
+        blitter->num_retired = 0;
+        SDL_CondBroadcast(blitter->cond);
+    }
+}
+
+/* Park the thread before the app's surfaces are destroyed: wait for the
+   frame it's working on, if any, and hand back every BO it holds from gs.
+   The thread keeps its context and surface, and sleeps until resumed. */
+void KMSDRM_BlitterSuspend(KMSDRM_Blitter *blitter, struct gbm_surface *gs)
+{
+    SDL_LockMutex(blitter->mutex);
+
+    blitter->suspended = 1;
+    KMSDRM_BlitterGiveBack(blitter, gs);
+    while (blitter->thread_busy) {
+        SDL_CondWait(blitter->cond, blitter->mutex);
+        KMSDRM_BlitterGiveBack(blitter, gs);
+    }
+
+    if (blitter->pending.bo) {
+        KMSDRM_gbm_surface_release_buffer(gs, blitter->pending.bo);
+        blitter->eglDestroySyncKHR(blitter->egl_display, blitter->pending.fence);
+        blitter->pending.bo = NULL;
+        blitter->pending.fence = EGL_NO_SYNC_KHR;
+    }
+
+    KMSDRM_BlitterGiveBack(blitter, gs);
+
+    SDL_UnlockMutex(blitter->mutex);
+}
+
+/* Hand the thread the sizes of the new surfaces. This doesn't wait: the
+   thread resizes on its own, before the first frame that needs it. */
+void KMSDRM_BlitterResume(KMSDRM_Blitter *blitter, GLsizei viewport_width, GLsizei viewport_height,
+                          GLint plane_width, GLint plane_height)
+{
+    SDL_LockMutex(blitter->mutex);
+    blitter->new_viewport_width = viewport_width;
+    blitter->new_viewport_height = viewport_height;
+    blitter->new_plane_width = plane_width;
+    blitter->new_plane_height = plane_height;
+    blitter->reconfigure = 1;
+    blitter->suspended = 0;
+    SDL_CondBroadcast(blitter->cond);
+    SDL_UnlockMutex(blitter->mutex);
+}
+
+/* Called from the BO destroy callback, when a BO dies before the blitter
+   that imported it. The import itself is freed later, on the thread. */
+void KMSDRM_BlitterForgetImport(KMSDRM_Blitter *blitter, KMSDRM_FBInfo *info)
+{
+    SDL_LockMutex(blitter->mutex);
+    if (info->blitter == blitter) {
+        blitter->imports[info->import_slot].info = NULL;
+        info->blitter = NULL;
+    }
+    SDL_UnlockMutex(blitter->mutex);
+}
+
+/* Hand a new frame to the blitter thread. Called from SwapWindow with the
+   app's freshly locked front buffer, and a fence for its rendering.
+   In mailbox mode this never waits: a frame the thread hasn't picked up yet
+   is dropped and replaced. Otherwise it waits for the slot to be free. */
+void KMSDRM_BlitterQueue(KMSDRM_Blitter *blitter, struct gbm_surface *gs,
+                         struct gbm_bo *bo, EGLSyncKHR fence, Uint64 swap_ns,
+                         const KMSDRM_Damage *damage, SDL_bool mailbox)
+{
+    KMSDRM_Damage frame_damage = *damage;
+
+    SDL_LockMutex(blitter->mutex);
+
+    if (!mailbox) {
+        while (blitter->pending.bo && !blitter->thread_stop) {
+            SDL_CondWait(blitter->cond, blitter->mutex);
+            KMSDRM_BlitterGiveBack(blitter, gs);
+        }
+    }
+
+    if (blitter->pending.bo) {
+        /* Never presented, straight back to the app's surface. What it
+           changed is still different from what's on screen. */
+        KMSDRM_gbm_surface_release_buffer(gs, blitter->pending.bo);
+        blitter->eglDestroySyncKHR(blitter->egl_display, blitter->pending.fence);
+        KMSDRM_MergeDamage(&frame_damage, &blitter->pending.damage);
+    }
+
+    blitter->pending.bo = bo;
+    blitter->pending.fence = fence;
+    blitter->pending.swap_ns = swap_ns;
+    blitter->pending.damage = frame_damage;
+
+    SDL_CondBroadcast(blitter->cond);
+    SDL_UnlockMutex(blitter->mutex);
+}
+
+/* Release the app BOs the thread is done drawing from. GBM surfaces aren't
+   thread safe, so this is done on the app's thread, before each swap. */
+void KMSDRM_BlitterReleaseBuffers(KMSDRM_Blitter *blitter, struct gbm_surface *gs)
+{
+    SDL_LockMutex(blitter->mutex);
+    KMSDRM_BlitterGiveBack(blitter, gs);
+    SDL_UnlockMutex(blitter->mutex);
+}
+
 #endif /* SDL_VIDEO_OPENGL_EGL */
\ No newline at end of file
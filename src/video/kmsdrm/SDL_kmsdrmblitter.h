@@ -14,11 +14,26 @@
 // Tracks teardown resources
 typedef struct KMSDRM_Blitter_Plane {
     EGLSyncKHR fence;
-    EGLImageKHR image;
     GLuint texture;
     struct gbm_bo *bo;
+    Uint64 swap_ns;
+    KMSDRM_Damage damage;   // In the app's BO coordinates
 } KMSDRM_Blitter_Plane;
 
+// An app BO imported into the blitter's context. GBM surfaces only rotate
+// among a few BOs, so imports are kept for as long as the BO lives; info is
+// cleared if the BO goes away first, and the import is freed on the thread.
+typedef struct KMSDRM_Blitter_Import {
+    KMSDRM_FBInfo *info;
+    EGLImageKHR image;
+    GLuint texture;
+} KMSDRM_Blitter_Import;
+
+#define KMSDRM_BLITTER_MAX_IMPORTS 8
+
+// Frames of damage kept for buffer age, deeper swap chains redraw everything
+#define KMSDRM_BLITTER_DAMAGE_HISTORY 4
+
 typedef struct KMSDRM_Blitter {
     /* OpenGL Surface and Context */
     _THIS;
@@ -28,6 +43,7 @@ typedef struct KMSDRM_Blitter {
     SDL_GLContext *gl_context;
     SDL_Window *window;
     EGLConfig config;
+    uint32_t format;            // GBM format of the output surface
     GLuint frag, vert, prog, vbo, vao;
     GLint loc_aVertCoord, loc_aTexCoord, loc_uFBOtex, loc_uProj, loc_uTexSize, loc_uScale;
     GLsizei viewport_width, viewport_height;
@@ -40,26 +56,68 @@ typedef struct KMSDRM_Blitter {
     SDL_cond *cond;
     SDL_Thread *thread;
     int thread_stop;
+    int thread_ready;
+    int thread_busy;
     int rotation;
-    int next;
+
+    // The thread outlives the app's surfaces: it's suspended while they're
+    // recreated, then picks up the new sizes without a context rebuild.
+    int suspended;
+    int reconfigure;
+    GLsizei new_viewport_width, new_viewport_height;
+    GLint new_plane_width, new_plane_height;
 
     struct gbm_surface *gs;
     struct gbm_bo *bo, *next_bo;
-    KMSDRM_Blitter_Plane planes[2];
+
+    // Frame queue: SwapWindow fills pending, the thread moves it to current,
+    // and hands the app's BO back through retired once it has been drawn.
+    KMSDRM_Blitter_Plane pending, current;
+    struct gbm_bo *retired[4];
+    int num_retired;
+
+    KMSDRM_Blitter_Import imports[KMSDRM_BLITTER_MAX_IMPORTS];
+    int next_import;
+
+    // Damage of our last frames, newest first, in our surface's top-left
+    // origin pixels. -1 if the back buffers can't be trusted at all.
+    SDL_Rect damage_history[KMSDRM_BLITTER_DAMAGE_HISTORY];
+    int num_damage_history;
+    SDL_bool has_buffer_age;
 
     void *user_data;
 
+    // GL_OES_get_program_binary, for the shader cache. NULL if unsupported.
+    void (APIENTRY *glGetProgramBinaryOES)(GLuint, GLsizei, GLsizei *, GLenum *, void *);
+    void (APIENTRY *glProgramBinaryOES)(GLuint, GLenum, const void *, GLint);
+
+    // EGL_KHR_swap_buffers_with_damage or the EXT one. NULL if unsupported.
+    EGLBoolean (APIENTRY *eglSwapBuffersWithDamage)(EGLDisplay, EGLSurface, const EGLint *, EGLint);
+
+    // Explicit sync: GPU waits on the app's fences, native fence FDs for KMS
+    SDL_bool explicit_sync;
+    EGLint (APIENTRY *eglDupNativeFenceFDANDROID)(EGLDisplay, EGLSyncKHR);
+
     #define SDL_PROC(ret,func,params) ret (APIENTRY *func) params;
     #include "SDL_kmsdrmblitter_egl_funcs.h"
     #include "SDL_kmsdrmblitter_gles_funcs.h"
     #undef SDL_PROC
 } KMSDRM_Blitter;
 
-extern int KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SDL_VideoData *viddata, struct gbm_bo *bo, struct gbm_bo *next_bo);
-extern int KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, NativeWindowType nw, int rotation);
+extern int KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SDL_VideoData *viddata, struct gbm_bo *bo, struct gbm_bo *next_bo,
+                              const KMSDRM_Damage *damage, int fence_fd);
+extern int KMSDRM_InitBlitter(_THIS, KMSDRM_Blitter *blitter, int rotation);
 extern int KMSDRM_BlitterThread(void *data);
 extern void KMSDRM_BlitterInit(KMSDRM_Blitter *blitter);
 extern void KMSDRM_BlitterQuit(KMSDRM_Blitter *blitter);
+extern void KMSDRM_BlitterQueue(KMSDRM_Blitter *blitter, struct gbm_surface *gs,
+                                struct gbm_bo *bo, EGLSyncKHR fence, Uint64 swap_ns,
+                                const KMSDRM_Damage *damage, SDL_bool mailbox);
+extern void KMSDRM_BlitterReleaseBuffers(KMSDRM_Blitter *blitter, struct gbm_surface *gs);
+extern void KMSDRM_BlitterForgetImport(KMSDRM_Blitter *blitter, KMSDRM_FBInfo *info);
+extern void KMSDRM_BlitterSuspend(KMSDRM_Blitter *blitter, struct gbm_surface *gs);
+extern void KMSDRM_BlitterResume(KMSDRM_Blitter *blitter, GLsizei viewport_width, GLsizei viewport_height,
+                                 GLint plane_width, GLint plane_height);
 
 #endif /* SDL_VIDEO_OPENGL_EGL */
 
@@ -18,6 +18,7 @@ SDL_PROC(EGLBoolean, eglSwapInterval, (EGLDisplay dpy, EGLint interval));
 SDL_PROC(const char *, eglQueryString, (EGLDisplay dpy, EGLint name));
 SDL_PROC(EGLenum, eglQueryAPI, (void));
 SDL_PROC(EGLBoolean, eglGetConfigAttrib, (EGLDisplay dpy, EGLConfig config, EGLint attribute, EGLint * value));
+SDL_PROC(EGLBoolean, eglQuerySurface, (EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLint * value));
 SDL_PROC(EGLBoolean, eglWaitNative, (EGLint  engine));
 SDL_PROC(EGLBoolean, eglWaitGL, (void));
 SDL_PROC(EGLBoolean, eglReleaseThread, (void));
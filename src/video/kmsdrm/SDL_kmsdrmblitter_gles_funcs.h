@@ -9,8 +9,8 @@ SDL_PROC(void, glClearColor, (GLclampf, GLclampf, GLclampf, GLclampf))
 SDL_PROC(void, glCompileShader, (GLuint))
 SDL_PROC(GLuint, glCreateProgram, (void))
 SDL_PROC(GLuint, glCreateShader, (GLenum))
-// SDL_PROC(void, glDeleteProgram, (GLuint))
-// SDL_PROC(void, glDeleteShader, (GLuint))
+SDL_PROC(void, glDeleteProgram, (GLuint))
+SDL_PROC(void, glDeleteShader, (GLuint))
 SDL_PROC(void, glDeleteTextures, (GLsizei, const GLuint *))
 SDL_PROC(void, glDisable, (GLenum))
 SDL_PROC(void, glDisableVertexAttribArray, (GLuint))
@@ -20,10 +20,10 @@ SDL_PROC(void, glEnableVertexAttribArray, (GLuint))
 // SDL_PROC(void, glFinish, (void))
 // SDL_PROC(void, glGenFramebuffers, (GLsizei, GLuint *))
 SDL_PROC(void, glGenTextures, (GLsizei, GLuint *))
-// SDL_PROC(const GLubyte *, glGetString, (GLenum))
+SDL_PROC(const GLubyte *, glGetString, (GLenum))
 SDL_PROC(GLenum, glGetError, (void))
 // SDL_PROC(void, glGetIntegerv, (GLenum, GLint *))
-// SDL_PROC(void, glGetProgramiv, (GLuint, GLenum, GLint *))
+SDL_PROC(void, glGetProgramiv, (GLuint, GLenum, GLint *))
 SDL_PROC(void, glGetShaderInfoLog, (GLuint, GLsizei, GLsizei *, char *))
 // SDL_PROC(void, glGetShaderiv, (GLuint, GLenum, GLint *))
 SDL_PROC(GLint, glGetUniformLocation, (GLuint, const char *))
@@ -43,6 +43,7 @@ SDL_PROC(void, glUniformMatrix4fv, (GLint, GLsizei, GLboolean, const GLfloat *))
 SDL_PROC(void, glUseProgram, (GLuint))
 SDL_PROC(void, glVertexAttribPointer, (GLuint, GLint, GLenum, GLboolean, GLsizei, const void *))
 SDL_PROC(void, glViewport, (GLint, GLint, GLsizei, GLsizei))
+SDL_PROC(void, glScissor, (GLint, GLint, GLsizei, GLsizei))
 // SDL_PROC(void, glBindFramebuffer, (GLenum, GLuint))
 // SDL_PROC(void, glFramebufferTexture2D, (GLenum, GLenum, GLenum, GLuint, GLint))
 // SDL_PROC(GLenum, glCheckFramebufferStatus, (GLenum))
@@ -0,0 +1,338 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_KMSDRM
+
+#include "SDL_timer.h"
+#include "SDL_kmsdrmvideo.h"
+#include "SDL_kmsdrmdyn.h"
+#include "SDL_kmsdrmcapture.h"
+
+#include <drm_fourcc.h>
+
+/* Drop frames from the ring, oldest first, until only keep are left.
+   Frames the app holds stay, so it returns how many are really left. */
+static int
+KMSDRM_CaptureTrim(KMSDRM_Capture *capture, int keep)
+{
+    KMSDRM_CaptureSlot *oldest;
+    int i, count;
+
+    for (;;) {
+        oldest = NULL;
+        count = 0;
+        for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+            KMSDRM_CaptureSlot *slot = &capture->slots[i];
+            if (slot->in_ring) {
+                count++;
+                if (!slot->acquired && (!oldest || (Sint32)(slot->id - oldest->id) < 0)) {
+                    oldest = slot;
+                }
+            }
+        }
+
+        if (count <= keep || !oldest) {
+            return count;
+        }
+
+        /* If its surface still has it, there's nothing to give back */
+        oldest->in_ring = SDL_FALSE;
+        if (!oldest->gs) {
+            SDL_zerop(oldest);
+        }
+    }
+}
+
+static KMSDRM_CaptureSlot *
+KMSDRM_CaptureFind(KMSDRM_Capture *capture, struct gbm_bo *bo)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+        if (capture->slots[i].bo == bo) {
+            return &capture->slots[i];
+        }
+    }
+    return NULL;
+}
+
+void
+KMSDRM_CaptureSubmit(KMSDRM_Capture *capture, struct gbm_bo *bo)
+{
+    SDL_AtomicLock(&capture->lock);
+    capture->inflight = capture->depth ? bo : NULL;
+    SDL_AtomicUnlock(&capture->lock);
+}
+
+/* Called from the page flip handler: the frame that was in flight is on
+   screen, and becomes the newest of the ring. */
+void
+KMSDRM_CaptureFlip(KMSDRM_Capture *capture, unsigned int sequence, Uint64 flip_ns)
+{
+    KMSDRM_CaptureSlot *slot = NULL;
+    struct gbm_bo *bo;
+
+    SDL_AtomicLock(&capture->lock);
+
+    bo = capture->inflight;
+    capture->inflight = NULL;
+    if (!bo || !capture->depth) {
+        SDL_AtomicUnlock(&capture->lock);
+        return;
+    }
+
+    /* Only if there's room left: with all of the ring acquired, or too
+       many BOs waiting to go back to their surface, the frame is missed. */
+    if (KMSDRM_CaptureTrim(capture, capture->depth - 1) < capture->depth) {
+        slot = KMSDRM_CaptureFind(capture, bo);
+        if (!slot) {
+            slot = KMSDRM_CaptureFind(capture, NULL);
+        }
+    }
+    if (slot && !slot->acquired) {
+        struct gbm_surface *gs = slot->gs;
+        SDL_zerop(slot);
+        slot->bo = bo;
+        slot->gs = gs;
+        slot->in_ring = SDL_TRUE;
+        slot->id = ++capture->next_id;
+        slot->sequence = sequence;
+        slot->flip_ns = flip_ns;
+    }
+
+    SDL_AtomicUnlock(&capture->lock);
+}
+
+void
+KMSDRM_CaptureReleaseBuffer(KMSDRM_Capture *capture, struct gbm_surface *gs, struct gbm_bo *bo)
+{
+    KMSDRM_CaptureSlot *slot;
+
+    SDL_AtomicLock(&capture->lock);
+    slot = KMSDRM_CaptureFind(capture, bo);
+    if (slot) {
+        slot->gs = gs;
+    }
+    SDL_AtomicUnlock(&capture->lock);
+
+    if (!slot) {
+        KMSDRM_gbm_surface_release_buffer(gs, bo);
+    }
+}
+
+/* Before looking for a buffer to draw into */
+void
+KMSDRM_CaptureCollect(KMSDRM_Capture *capture, struct gbm_surface *gs)
+{
+    struct gbm_bo *bos[SDL_arraysize(capture->slots)];
+    int i, num_bos = 0;
+
+    SDL_AtomicLock(&capture->lock);
+    for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+        KMSDRM_CaptureSlot *slot = &capture->slots[i];
+        if (slot->bo && slot->gs == gs && !slot->in_ring && !slot->acquired) {
+            bos[num_bos++] = slot->bo;
+            SDL_zerop(slot);
+        }
+    }
+    SDL_AtomicUnlock(&capture->lock);
+
+    for (i = 0; i < num_bos; i++) {
+        KMSDRM_gbm_surface_release_buffer(gs, bos[i]);
+    }
+}
+
+/* The surface is going away, with the BOs the app may still hold. Their
+   dma-bufs stay valid, only their contents aren't ours to keep anymore.
+   Frames its presenting side still has are dropped too, whatever surface
+   they're from: they'd go away with it if they're from this one. */
+void
+KMSDRM_CaptureForget(KMSDRM_Capture *capture, struct gbm_surface *gs)
+{
+    struct gbm_bo *bos[SDL_arraysize(capture->slots)];
+    SDL_bool exporting;
+    int i, num_bos = 0;
+
+    /* A frame being acquired needs its BO until it's exported */
+    for (;;) {
+        SDL_AtomicLock(&capture->lock);
+        exporting = SDL_FALSE;
+        for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+            exporting = exporting || capture->slots[i].exporting;
+        }
+        if (!exporting) {
+            break;
+        }
+        SDL_AtomicUnlock(&capture->lock);
+        SDL_Delay(0);
+    }
+
+    for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+        KMSDRM_CaptureSlot *slot = &capture->slots[i];
+        if (slot->bo && slot->gs == gs) {
+            bos[num_bos++] = slot->bo;
+            SDL_zerop(slot);
+        } else if (!slot->gs) {
+            SDL_zerop(slot);
+        }
+    }
+    capture->inflight = NULL;
+    SDL_AtomicUnlock(&capture->lock);
+
+    for (i = 0; i < num_bos; i++) {
+        KMSDRM_gbm_surface_release_buffer(gs, bos[i]);
+    }
+}
+
+#ifdef __LINUX__
+int
+KMSDRM_SetCaptureFrames(_THIS, SDL_Window *window, int count)
+{
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    KMSDRM_Capture *capture = &windata->capture;
+
+    if (count < 0 || count > KMSDRM_CAPTURE_MAX_FRAMES) {
+        return SDL_SetError("Up to %d frames can be retained", KMSDRM_CAPTURE_MAX_FRAMES);
+    }
+
+    /* The presenting side gives back what doesn't fit on its next frame */
+    SDL_AtomicLock(&capture->lock);
+    capture->depth = count;
+    KMSDRM_CaptureTrim(capture, count);
+    if (!count) {
+        capture->inflight = NULL;
+    }
+    SDL_AtomicUnlock(&capture->lock);
+
+    return 0;
+}
+
+/* The BO is exported out of the lock, the flip handler spins on it. Once
+   acquired it can't go back to its surface, and while it's exporting
+   KMSDRM_CaptureForget() waits for it, so the surface can't take it away. */
+int
+KMSDRM_AcquireCaptureFrame(_THIS, SDL_Window *window, SDL_KMSDRMCaptureFrame *frame)
+{
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    KMSDRM_Capture *capture = &windata->capture;
+    KMSDRM_CaptureSlot *slot = NULL;
+    struct gbm_bo *bo;
+    int i, fd;
+
+    SDL_zerop(frame);
+    frame->fd = -1;
+
+    SDL_AtomicLock(&capture->lock);
+
+    for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+        KMSDRM_CaptureSlot *candidate = &capture->slots[i];
+        if (candidate->in_ring && !candidate->acquired &&
+            (Sint32)(candidate->id - capture->last_acquired) > 0 &&
+            (!slot || (Sint32)(candidate->id - slot->id) < 0)) {
+            slot = candidate;
+        }
+    }
+
+    if (!slot) {
+        SDL_AtomicUnlock(&capture->lock);
+        return 0;
+    }
+
+    bo = slot->bo;
+    slot->acquired = SDL_TRUE;
+    slot->exporting = SDL_TRUE;
+    capture->last_acquired = slot->id;
+    frame->flip_ns = slot->flip_ns;
+    frame->sequence = slot->sequence;
+    frame->id = slot->id;
+
+    SDL_AtomicUnlock(&capture->lock);
+
+    fd = KMSDRM_gbm_bo_get_fd(bo);
+    if (fd < 0) {
+        SDL_AtomicLock(&capture->lock);
+        slot->exporting = SDL_FALSE;
+        slot->acquired = SDL_FALSE;
+        if (!slot->in_ring && !slot->gs) {
+            SDL_zerop(slot);
+        }
+        SDL_AtomicUnlock(&capture->lock);
+        SDL_zerop(frame);
+        frame->fd = -1;
+        return SDL_SetError("Could not export the frame as a dma-buf");
+    }
+
+    frame->fd = fd;
+    frame->width = KMSDRM_gbm_bo_get_width(bo);
+    frame->height = KMSDRM_gbm_bo_get_height(bo);
+    frame->format = KMSDRM_gbm_bo_get_format(bo);
+
+    if (KMSDRM_gbm_bo_get_modifier && KMSDRM_gbm_bo_get_plane_count &&
+        KMSDRM_gbm_bo_get_stride_for_plane && KMSDRM_gbm_bo_get_offset) {
+        frame->modifier = KMSDRM_gbm_bo_get_modifier(bo);
+        frame->num_planes = SDL_min(KMSDRM_gbm_bo_get_plane_count(bo), 4);
+        for (i = 0; i < frame->num_planes; i++) {
+            frame->offsets[i] = KMSDRM_gbm_bo_get_offset(bo, i);
+            frame->pitches[i] = KMSDRM_gbm_bo_get_stride_for_plane(bo, i);
+        }
+    } else {
+        frame->modifier = DRM_FORMAT_MOD_INVALID;
+        frame->num_planes = 1;
+        frame->pitches[0] = KMSDRM_gbm_bo_get_stride(bo);
+    }
+
+    SDL_AtomicLock(&capture->lock);
+    slot->exporting = SDL_FALSE;
+    SDL_AtomicUnlock(&capture->lock);
+
+    return 1;
+}
+
+/* Frames from a surface that's gone were forgotten already */
+int
+KMSDRM_ReleaseCaptureFrame(_THIS, SDL_Window *window, const SDL_KMSDRMCaptureFrame *frame)
+{
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    KMSDRM_Capture *capture = &windata->capture;
+    int i;
+
+    SDL_AtomicLock(&capture->lock);
+    for (i = 0; i < SDL_arraysize(capture->slots); i++) {
+        KMSDRM_CaptureSlot *slot = &capture->slots[i];
+        if (slot->bo && slot->acquired && !slot->exporting && slot->id == frame->id) {
+            slot->acquired = SDL_FALSE;
+            if (!slot->in_ring && !slot->gs) {
+                SDL_zerop(slot);
+            }
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&capture->lock);
+
+    return 0;
+}
+#endif /* __LINUX__ */
+
+#endif /* SDL_VIDEO_DRIVER_KMSDRM */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,75 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifndef SDL_kmsdrmcapture_h_
+#define SDL_kmsdrmcapture_h_
+
+#include "SDL_atomic.h"
+
+#include <gbm.h>
+
+/* Most frames a window retains for SDL_KMSDRMAcquireCaptureFrame(). GBM
+   surfaces only have a few buffers, and scanout already holds two. */
+#define KMSDRM_CAPTURE_MAX_FRAMES 2
+
+typedef struct KMSDRM_CaptureSlot
+{
+    struct gbm_bo *bo;          /* NULL if the slot is free */
+    struct gbm_surface *gs;     /* Set once the presenting side let go of the BO,
+                                   it's then ours to give back */
+    SDL_bool in_ring;           /* One of the last frames shown */
+    SDL_bool acquired;          /* Handed out, until the app releases it */
+    SDL_bool exporting;         /* Acquired and being exported, out of the lock */
+    Uint32 id;
+    Uint32 sequence;
+    Uint64 flip_ns;
+} KMSDRM_CaptureSlot;
+
+/* Per-window ring of the last frames shown, for zero-copy capture. Frames
+   are recorded from the page flip handler, acquired and released from any
+   thread, and BOs go back to their GBM surface from the thread presenting
+   to it, hence the lock. Slots out of the ring may still wait for that. */
+typedef struct KMSDRM_Capture
+{
+    SDL_SpinLock lock;
+    int depth;                  /* Frames to retain, 0 when not capturing */
+    KMSDRM_CaptureSlot slots[KMSDRM_CAPTURE_MAX_FRAMES * 2];
+    struct gbm_bo *inflight;    /* Committed, waiting for its flip */
+    Uint32 next_id;
+    Uint32 last_acquired;       /* Newest frame handed out */
+} KMSDRM_Capture;
+
+/* Swap path hooks, next to the timing ones */
+extern void KMSDRM_CaptureSubmit(KMSDRM_Capture *capture, struct gbm_bo *bo);
+extern void KMSDRM_CaptureFlip(KMSDRM_Capture *capture, unsigned int sequence, Uint64 flip_ns);
+
+/* For the presenting side: gbm_surface_release_buffer() for scanout BOs,
+   giving back the retained ones that aren't needed anymore, and dropping
+   everything from a surface about to be destroyed. */
+extern void KMSDRM_CaptureReleaseBuffer(KMSDRM_Capture *capture, struct gbm_surface *gs, struct gbm_bo *bo);
+extern void KMSDRM_CaptureCollect(KMSDRM_Capture *capture, struct gbm_surface *gs);
+extern void KMSDRM_CaptureForget(KMSDRM_Capture *capture, struct gbm_surface *gs);
+
+#endif /* SDL_kmsdrmcapture_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
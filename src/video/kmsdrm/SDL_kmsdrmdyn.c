@@ -82,6 +82,7 @@ KMSDRM_GetSym(const char *fnname, int *pHasModule)
 #define SDL_KMSDRM_MODULE(modname) int SDL_KMSDRM_HAVE_##modname = 0;
 #define SDL_KMSDRM_SYM(rc,fn,params) SDL_DYNKMSDRMFN_##fn KMSDRM_##fn = NULL;
 #define SDL_KMSDRM_SYM_CONST(type,name) SDL_DYNKMSDRMCONST_##name KMSDRM_##name = NULL;
+#define SDL_KMSDRM_SYM_OPT(rc,fn,params) SDL_DYNKMSDRMFN_##fn KMSDRM_##fn = NULL;
 #include "SDL_kmsdrmsym.h"
 
 static int kmsdrm_load_refcount = 0;
@@ -100,6 +101,7 @@ SDL_KMSDRM_UnloadSymbols(void)
 #define SDL_KMSDRM_MODULE(modname) SDL_KMSDRM_HAVE_##modname = 0;
 #define SDL_KMSDRM_SYM(rc,fn,params) KMSDRM_##fn = NULL;
 #define SDL_KMSDRM_SYM_CONST(type,name) KMSDRM_##name = NULL;
+#define SDL_KMSDRM_SYM_OPT(rc,fn,params) KMSDRM_##fn = NULL;
 #include "SDL_kmsdrmsym.h"
 
 
@@ -126,6 +128,7 @@ SDL_KMSDRM_LoadSymbols(void)
 #ifdef SDL_VIDEO_DRIVER_KMSDRM_DYNAMIC
         int i;
         int *thismod = NULL;
+        int optional = 1;   /* Missing optional symbols don't kill their module */
         for (i = 0; i < SDL_TABLESIZE(kmsdrmlibs); i++) {
             if (kmsdrmlibs[i].libname != NULL) {
                 kmsdrmlibs[i].lib = SDL_LoadObject(kmsdrmlibs[i].libname);
@@ -138,6 +141,7 @@ SDL_KMSDRM_LoadSymbols(void)
 #define SDL_KMSDRM_MODULE(modname) thismod = &SDL_KMSDRM_HAVE_##modname;
 #define SDL_KMSDRM_SYM(rc,fn,params) KMSDRM_##fn = (SDL_DYNKMSDRMFN_##fn) KMSDRM_GetSym(#fn,thismod);
 #define SDL_KMSDRM_SYM_CONST(type,name) KMSDRM_##name = *(SDL_DYNKMSDRMCONST_##name*) KMSDRM_GetSym(#name,thismod);
+#define SDL_KMSDRM_SYM_OPT(rc,fn,params) KMSDRM_##fn = (SDL_DYNKMSDRMFN_##fn) KMSDRM_GetSym(#fn,&optional);
 #include "SDL_kmsdrmsym.h"
 
         if ((SDL_KMSDRM_HAVE_LIBDRM) && (SDL_KMSDRM_HAVE_GBM)) {
@@ -154,6 +158,7 @@ SDL_KMSDRM_LoadSymbols(void)
 #define SDL_KMSDRM_MODULE(modname) SDL_KMSDRM_HAVE_##modname = 1; /* default yes */
 #define SDL_KMSDRM_SYM(rc,fn,params) KMSDRM_##fn = fn;
 #define SDL_KMSDRM_SYM_CONST(type,name) KMSDRM_##name = name;
+#define SDL_KMSDRM_SYM_OPT(rc,fn,params) KMSDRM_##fn = fn;
 #include "SDL_kmsdrmsym.h"
 
 #endif
@@ -25,6 +25,7 @@
 
 #include "SDL_kmsdrmvideo.h"
 #include "SDL_kmsdrmevents.h"
+#include "SDL_kmsdrmatomic.h"
 
 #ifdef SDL_INPUT_LINUXEV
 #include "../../core/linux/SDL_evdev.h"
@@ -32,15 +33,103 @@
 #include "../../core/openbsd/SDL_wscons.h"
 #endif
 
+#include <errno.h>
+#include <poll.h>
+
+/* FDs SDL_WaitEvent() sleeps on: the wakeup eventfd, DRM and input devices.
+   Input devices past that are still read, they just don't wake us up. */
+#define KMSDRM_MAX_WAIT_FDS 64
+
+/* Hotplugged input devices aren't watched for, look for them this often */
+#define KMSDRM_HOTPLUG_POLL_MS 250
+
 void KMSDRM_PumpEvents(_THIS)
 {
+    int i;
+
 #ifdef SDL_INPUT_LINUXEV
     SDL_EVDEV_Poll();
 #elif defined SDL_INPUT_WSCONS
     SDL_WSCONS_PumpEvents();
 #endif
 
+    /* Page flips that completed while nobody was waiting for them */
+    KMSDRM_DispatchDRMEvents(_this);
+    KMSDRM_SendFlipEvents(_this);
+
+    /* Cursor moves on an atomic display normally ride along with the next
+       frame. If the app isn't presenting, commit them from here. */
+    for (i = 0; i < SDL_GetNumVideoDisplays(); i++) {
+        SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayDriverData(i);
+        if (dispdata && dispdata->atomic) {
+            KMSDRM_AtomicFlush(_this, dispdata);
+        }
+    }
+}
+
+#ifdef SDL_INPUT_LINUXEV
+void KMSDRM_SendWakeupEvent(_THIS, SDL_Window *window)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    const Uint64 one = 1;
+
+    if (write(viddata->wakeup_fd, &one, sizeof(one)) < 0) {
+        /* The counter is saturated, so a wakeup is pending anyway */
+    }
+}
+
+/* Sleep until there's something for KMSDRM_PumpEvents() to do. Events are
+   only dispatched from there, so any wakeup just returns 1. */
+int KMSDRM_WaitEventTimeout(_THIS, int timeout)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    struct pollfd pfds[KMSDRM_MAX_WAIT_FDS];
+    int fds[KMSDRM_MAX_WAIT_FDS];
+    int i, num_pfds = 0, num_fds, wait, ret;
+    Uint64 count;
+
+    pfds[num_pfds].fd = viddata->wakeup_fd;
+    pfds[num_pfds++].events = POLLIN;
+
+    if (viddata->drm_fd >= 0) {
+        pfds[num_pfds].fd = viddata->drm_fd;
+        pfds[num_pfds++].events = POLLIN;
+    }
+
+    num_fds = SDL_EVDEV_GetFDs(fds, KMSDRM_MAX_WAIT_FDS - num_pfds);
+    for (i = 0; i < num_fds; i++) {
+        pfds[num_pfds].fd = fds[i];
+        pfds[num_pfds++].events = POLLIN;
+    }
+
+    wait = timeout;
+    if (wait < 0 || wait > KMSDRM_HOTPLUG_POLL_MS) {
+        wait = KMSDRM_HOTPLUG_POLL_MS;
+    }
+
+    ret = poll(pfds, num_pfds, wait);
+    if (ret < 0) {
+        /* A signal may have been turned into SDL_QUIT, let it be pumped */
+        if (errno == EINTR) {
+            return 1;
+        }
+        return SDL_SetError("KMSDRM: poll() failed: %s", strerror(errno));
+    }
+
+    if (ret == 0) {
+        /* Only a timeout if it was the app's, otherwise pump for hotplug */
+        return (wait == timeout) ? 0 : 1;
+    }
+
+    if (pfds[0].revents & POLLIN) {
+        if (read(viddata->wakeup_fd, &count, sizeof(count)) < 0) {
+            /* Somebody else drained it */
+        }
+    }
+
+    return 1;
 }
+#endif /* SDL_INPUT_LINUXEV */
 
 #endif /* SDL_VIDEO_DRIVER_KMSDRM */
 
@@ -25,6 +25,8 @@
 #define SDL_kmsdrmevents_h_
 
 extern void KMSDRM_PumpEvents(_THIS);
+extern int KMSDRM_WaitEventTimeout(_THIS, int timeout);
+extern void KMSDRM_SendWakeupEvent(_THIS, SDL_Window *window);
 extern void KMSDRM_EventInit(_THIS);
 extern void KMSDRM_EventQuit(_THIS);
 
@@ -0,0 +1,337 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_KMSDRM
+
+#include "SDL_log.h"
+
+#include "SDL_kmsdrmvideo.h"
+#include "SDL_kmsdrmdyn.h"
+#include "SDL_kmsdrmframebuffer.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+
+static void
+KMSDRM_DestroyDumbBuffer(int drm_fd, KMSDRM_DumbBuffer *buf)
+{
+    struct drm_mode_destroy_dumb destroy;
+
+    if (buf->map) {
+        munmap(buf->map, buf->size);
+    }
+
+    if (buf->fb_id) {
+        KMSDRM_drmModeRmFB(drm_fd, buf->fb_id);
+    }
+
+    if (buf->handle) {
+        SDL_zero(destroy);
+        destroy.handle = buf->handle;
+        KMSDRM_drmIoctl(drm_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+    }
+
+    SDL_zerop(buf);
+}
+
+static int
+KMSDRM_CreateDumbBuffer(int drm_fd, KMSDRM_DumbBuffer *buf, uint32_t width, uint32_t height)
+{
+    struct drm_mode_create_dumb create;
+    struct drm_mode_map_dumb map;
+    void *pixels;
+
+    SDL_zero(create);
+    create.width = width;
+    create.height = height;
+    create.bpp = 32;
+
+    if (KMSDRM_drmIoctl(drm_fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) < 0) {
+        return SDL_SetError("Could not create dumb buffer: %s", strerror(errno));
+    }
+
+    buf->handle = create.handle;
+    buf->pitch = create.pitch;
+    buf->size = create.size;
+
+    if (KMSDRM_drmModeAddFB(drm_fd, width, height, 24, 32, buf->pitch, buf->handle, &buf->fb_id)) {
+        buf->fb_id = 0;
+        return SDL_SetError("Could not create framebuffer for dumb buffer");
+    }
+
+    SDL_zero(map);
+    map.handle = buf->handle;
+
+    if (KMSDRM_drmIoctl(drm_fd, DRM_IOCTL_MODE_MAP_DUMB, &map) < 0) {
+        return SDL_SetError("Could not prepare dumb buffer for mapping: %s", strerror(errno));
+    }
+
+    pixels = mmap(NULL, buf->size, PROT_READ | PROT_WRITE, MAP_SHARED, drm_fd, map.offset);
+    if (pixels == MAP_FAILED) {
+        return SDL_SetError("Could not map dumb buffer: %s", strerror(errno));
+    }
+    buf->map = pixels;
+
+    /* Start out black, like the cleared shadow buffer, so that only the
+       updated rects ever need copying. */
+    SDL_memset(buf->map, 0, buf->size);
+
+    return 0;
+}
+
+/* The buffer queued last is on screen once its flip has come in. */
+static void
+KMSDRM_RetireDumbBuffers(SDL_WindowData *windata, KMSDRM_Framebuffer *fb)
+{
+    if (fb->queued >= 0 && !windata->waiting_for_flip) {
+        fb->front = fb->queued;
+        fb->queued = -1;
+    }
+}
+
+static int
+KMSDRM_GetBackDumbBuffer(KMSDRM_Framebuffer *fb)
+{
+    int i;
+
+    for (i = 0; i < fb->num_buffers; i++) {
+        if (i != fb->front && i != fb->queued) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void
+KMSDRM_CopyToDumbBuffer(KMSDRM_Framebuffer *fb, KMSDRM_DumbBuffer *buf, const SDL_Rect *rect)
+{
+    const Uint8 *src = (const Uint8 *)fb->pixels + rect->y * fb->pitch + rect->x * 4;
+    Uint8 *dst = (Uint8 *)buf->map + (fb->y + rect->y) * buf->pitch + (fb->x + rect->x) * 4;
+    int row;
+
+    for (row = 0; row < rect->h; row++) {
+        SDL_memcpy(dst, src, rect->w * 4);
+        src += fb->pitch;
+        dst += buf->pitch;
+    }
+}
+
+int
+KMSDRM_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format,
+                               void ** pixels, int *pitch)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    KMSDRM_Framebuffer *fb;
+    uint64_t has_dumb = 0;
+    int i;
+
+    /* Free the old framebuffer, the window may have been resized */
+    KMSDRM_DestroyWindowFramebuffer(_this, window);
+
+    if (KMSDRM_drmGetCap(viddata->drm_fd, DRM_CAP_DUMB_BUFFER, &has_dumb) || !has_dumb) {
+        return SDL_SetError("DRM device doesn't support dumb buffers");
+    }
+
+    fb = (KMSDRM_Framebuffer *)SDL_calloc(1, sizeof(KMSDRM_Framebuffer));
+    if (!fb) {
+        return SDL_OutOfMemory();
+    }
+    windata->framebuffer = fb;
+
+    fb->front = -1;
+    fb->queued = -1;
+    fb->num_buffers = windata->double_buffer ? 2 : KMSDRM_MAX_DUMB_BUFFERS;
+
+    /* The framebuffer isn't scaled or rotated: the window is centered in
+       the mode, and cropped if it doesn't fit. */
+    KMSDRM_GetModeToSet(window, &fb->mode, 0);
+    fb->x = SDL_max(fb->mode.hdisplay - window->w, 0) / 2;
+    fb->y = SDL_max(fb->mode.vdisplay - window->h, 0) / 2;
+
+    KMSDRM_TimingSetMode(&windata->timing, &fb->mode);
+
+    for (i = 0; i < fb->num_buffers; i++) {
+        if (KMSDRM_CreateDumbBuffer(viddata->drm_fd, &fb->buffers[i], fb->mode.hdisplay, fb->mode.vdisplay)) {
+            KMSDRM_DestroyWindowFramebuffer(_this, window);
+            return -1;
+        }
+    }
+
+    fb->pitch = window->w * 4;
+    fb->pixels = SDL_calloc(window->h, fb->pitch);
+    if (!fb->pixels) {
+        KMSDRM_DestroyWindowFramebuffer(_this, window);
+        return SDL_OutOfMemory();
+    }
+
+    *format = SDL_PIXELFORMAT_RGB888;
+    *pixels = fb->pixels;
+    *pitch = fb->pitch;
+
+    return 0;
+}
+
+int
+KMSDRM_UpdateWindowFramebuffer(_THIS, SDL_Window * window,
+                               const SDL_Rect * rects, int numrects)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
+    KMSDRM_Framebuffer *fb = windata->framebuffer;
+    KMSDRM_DumbBuffer *buf;
+    SDL_Rect bounds, damage, rect;
+    int back, i, ret;
+
+    if (!fb) {
+        return SDL_SetError("Window has no framebuffer");
+    }
+
+    /* The visible part of the window */
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = SDL_min(window->w, fb->mode.hdisplay);
+    bounds.h = SDL_min(window->h, fb->mode.vdisplay);
+
+    SDL_zero(damage);
+    for (i = 0; i < numrects; i++) {
+        if (SDL_IntersectRect(&rects[i], &bounds, &rect)) {
+            SDL_UnionRect(&damage, &rect, &damage);
+        }
+    }
+
+    /* Nothing changed, nothing to flip */
+    if (SDL_RectEmpty(&damage) && fb->front >= 0) {
+        return 0;
+    }
+
+    KMSDRM_RetireDumbBuffers(windata, fb);
+    back = KMSDRM_GetBackDumbBuffer(fb);
+
+    /* Double buffering with a flip pending: the only other buffer is the one
+       that's about to be scanned out. */
+    if (back < 0) {
+        if (!KMSDRM_WaitPageflip(_this, windata)) {
+            return SDL_SetError("Wait for previous pageflip failed");
+        }
+        KMSDRM_RetireDumbBuffers(windata, fb);
+        back = KMSDRM_GetBackDumbBuffer(fb);
+    }
+
+    buf = &fb->buffers[back];
+
+    for (i = 0; i < numrects; i++) {
+        if (SDL_IntersectRect(&rects[i], &bounds, &rect)) {
+            KMSDRM_CopyToDumbBuffer(fb, buf, &rect);
+        }
+    }
+
+    /* Catch up with the updates that went to the other buffers */
+    if (SDL_IntersectRect(&buf->stale, &bounds, &rect)) {
+        KMSDRM_CopyToDumbBuffer(fb, buf, &rect);
+    }
+    SDL_zero(buf->stale);
+
+    for (i = 0; i < fb->num_buffers; i++) {
+        if (i != back) {
+            SDL_UnionRect(&fb->buffers[i].stale, &damage, &fb->buffers[i].stale);
+        }
+    }
+
+    KMSDRM_TimingSwap(&windata->timing, KMSDRM_TimingNow());
+
+    /* Legacy page flips can't be queued, wait for the previous one. With
+       triple buffering this happens after the copy, not before. */
+    if (windata->waiting_for_flip && !KMSDRM_WaitPageflip(_this, windata)) {
+        return SDL_SetError("Wait for previous pageflip failed");
+    }
+    KMSDRM_RetireDumbBuffers(windata, fb);
+
+    if (fb->front < 0) {
+        /* First frame: configure the CRTC with our mode and buffer */
+        ret = KMSDRM_drmModeSetCrtc(viddata->drm_fd, dispdata->crtc->crtc_id, buf->fb_id, 0, 0,
+                                    &dispdata->connector->connector_id, 1, &fb->mode);
+        if (ret) {
+            return SDL_SetError("Could not set videomode on CRTC: (%d).", ret);
+        }
+
+        dispdata->atomic_mode = fb->mode;
+        fb->front = back;
+    } else {
+        KMSDRM_TimingSubmit(&windata->timing);
+        ret = KMSDRM_drmModePageFlip(viddata->drm_fd, dispdata->crtc->crtc_id, buf->fb_id,
+                                     DRM_MODE_PAGE_FLIP_EVENT, windata);
+        if (ret) {
+            return SDL_SetError("Could not queue pageflip: %d", ret);
+        }
+
+        windata->waiting_for_flip = SDL_TRUE;
+        fb->queued = back;
+    }
+
+    return 0;
+}
+
+void
+KMSDRM_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
+{
+    SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    SDL_DisplayData *dispdata;
+    KMSDRM_Framebuffer *fb;
+    int i;
+
+    if (!windata || !windata->framebuffer) {
+        return;
+    }
+
+    fb = windata->framebuffer;
+    dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
+
+    /* Give the CRTC back its original buffer before ours go away */
+    if (fb->front >= 0) {
+        KMSDRM_WaitPageflip(_this, windata);
+
+        if (KMSDRM_drmModeSetCrtc(viddata->drm_fd, dispdata->crtc->crtc_id,
+                                  dispdata->crtc->buffer_id, 0, 0, &dispdata->connector->connector_id, 1,
+                                  &dispdata->original_mode)) {
+            SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not restore CRTC");
+        } else {
+            dispdata->atomic_mode = dispdata->original_mode;
+        }
+    }
+
+    for (i = 0; i < fb->num_buffers; i++) {
+        KMSDRM_DestroyDumbBuffer(viddata->drm_fd, &fb->buffers[i]);
+    }
+
+    SDL_free(fb->pixels);
+    SDL_free(fb);
+    windata->framebuffer = NULL;
+}
+
+#endif /* SDL_VIDEO_DRIVER_KMSDRM */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,70 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifndef SDL_kmsdrmframebuffer_h_
+#define SDL_kmsdrmframebuffer_h_
+
+#include <stdint.h>
+#include <xf86drmMode.h>
+
+/* Up to triple buffering: one buffer on screen, one waiting for its flip
+   and one being filled. */
+#define KMSDRM_MAX_DUMB_BUFFERS 3
+
+typedef struct KMSDRM_DumbBuffer
+{
+    uint32_t handle;
+    uint32_t pitch;
+    uint64_t size;
+    uint32_t fb_id;
+    void *map;
+    SDL_Rect stale;             /* Damage from the updates this buffer missed */
+} KMSDRM_DumbBuffer;
+
+/* Window framebuffer for SDL_GetWindowSurface(). The app draws into a shadow
+   buffer in system memory, and updated rects are copied to a dumb buffer
+   that is page flipped to the screen. Scanout memory is often uncached, so
+   the app never reads from it. */
+typedef struct KMSDRM_Framebuffer
+{
+    KMSDRM_DumbBuffer buffers[KMSDRM_MAX_DUMB_BUFFERS];
+    int num_buffers;
+    int front;                  /* On screen, -1 until the first modeset */
+    int queued;                 /* Waiting for its page flip, -1 if none */
+
+    drmModeModeInfo mode;
+    int x, y;                   /* Window position in the buffers, centered */
+
+    void *pixels;               /* Shadow buffer, window sized */
+    int pitch;
+} KMSDRM_Framebuffer;
+
+extern int KMSDRM_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format,
+                                          void ** pixels, int *pitch);
+extern int KMSDRM_UpdateWindowFramebuffer(_THIS, SDL_Window * window,
+                                          const SDL_Rect * rects, int numrects);
+extern void KMSDRM_DestroyWindowFramebuffer(_THIS, SDL_Window * window);
+
+#endif /* SDL_kmsdrmframebuffer_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
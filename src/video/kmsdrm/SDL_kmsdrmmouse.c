@@ -26,6 +26,7 @@
 #include "SDL_kmsdrmvideo.h"
 #include "SDL_kmsdrmmouse.h"
 #include "SDL_kmsdrmdyn.h"
+#include "SDL_kmsdrmatomic.h"
 
 #include "../../events/SDL_mouse_c.h"
 #include "../../events/default_cursor.h"
@@ -40,6 +41,11 @@ static void KMSDRM_FreeCursor(SDL_Cursor * cursor);
 static void KMSDRM_WarpMouse(SDL_Window * window, int x, int y);
 static int KMSDRM_WarpMouseGlobal(int x, int y);
 
+/* With atomic modesetting, the cursor lives on a cursor plane whose updates
+   go along with the next page flip instead of through the legacy ioctls. */
+#define KMSDRM_HasAtomicCursor(dispdata) \
+    ((dispdata)->atomic && (dispdata)->cursor_plane_props.props)
+
 /**************************************************************************************/
 /* BEFORE CODING ANYTHING MOUSE/CURSOR RELATED, REMEMBER THIS.                        */
 /* How does SDL manage cursors internally? First, mouse =! cursor. The mouse can have */
@@ -61,7 +67,39 @@ KMSDRM_CreateDefaultCursor(void)
     return SDL_CreateCursor(default_cdata, default_cmask, DEFAULT_CWIDTH, DEFAULT_CHEIGHT, DEFAULT_CHOTX, DEFAULT_CHOTY);
 }
 
-/* Given a display's driverdata, destroy the cursor BO for it.
+/* Drop the BO of every cursor: they belong to the GBM device, which may be
+   about to go. They're made again next time a cursor is shown. */
+static void
+KMSDRM_DestroyCursorBOs(void)
+{
+    SDL_Mouse *mouse = SDL_GetMouse();
+    SDL_Cursor *cursor;
+    KMSDRM_CursorData *curdata;
+    int i;
+
+    for (i = 0; i < SDL_GetNumVideoDisplays(); i++) {
+        ((SDL_DisplayData *) SDL_GetDisplayDriverData(i))->cursor_bo = NULL;
+    }
+
+    for (cursor = mouse->cursors; cursor; cursor = cursor->next) {
+        curdata = (KMSDRM_CursorData *) cursor->driverdata;
+        if (curdata && curdata->bo) {
+            KMSDRM_gbm_bo_destroy(curdata->bo);
+            curdata->bo = NULL;
+        }
+    }
+
+    /* The default cursor is in the list too, unless the app made its own */
+    if (mouse->def_cursor) {
+        curdata = (KMSDRM_CursorData *) mouse->def_cursor->driverdata;
+        if (curdata && curdata->bo) {
+            KMSDRM_gbm_bo_destroy(curdata->bo);
+            curdata->bo = NULL;
+        }
+    }
+}
+
+/* Given a display's driverdata, destroy the cursor BOs for it.
    To be called from KMSDRM_DestroyWindow(), as that's where we
    destroy the driverdata for the window's display. */
 void
@@ -69,15 +107,11 @@ KMSDRM_DestroyCursorBO (_THIS, SDL_VideoDisplay *display)
 {
     SDL_DisplayData *dispdata = (SDL_DisplayData *) display->driverdata;
    
-    /* Destroy the curso GBM BO. */
-    if (dispdata->cursor_bo) {
-        KMSDRM_gbm_bo_destroy(dispdata->cursor_bo);
-        dispdata->cursor_bo = NULL;
-        dispdata->cursor_bo_drm_fd = -1;
-    }
+    KMSDRM_DestroyCursorBOs();
+    dispdata->cursor_bo_drm_fd = -1;
 }
 
-/* Given a display's driverdata, create the cursor BO for it.
+/* Given a display's driverdata, get it ready for cursors.
    To be called from KMSDRM_CreateWindow(), as that's where we
    build a window and assign a display to it. */
 void
@@ -109,17 +143,71 @@ KMSDRM_CreateCursorBO (SDL_VideoDisplay *display) {
         return;
     }
 
-    dispdata->cursor_bo = KMSDRM_gbm_bo_create(viddata->gbm_dev,
+    dispdata->cursor_bo = NULL;
+    dispdata->cursor_bo_drm_fd = viddata->drm_fd;
+} 
+
+/* Make the cursor's BO, if it hasn't got one yet: the only time its pixels
+   are copied (padded, and clipped if the hardware cursor is smaller). */
+static struct gbm_bo *
+KMSDRM_GetCursorBO(SDL_DisplayData *dispdata, KMSDRM_CursorData *curdata)
+{
+    SDL_VideoDevice *video_device = SDL_GetVideoDevice();
+    SDL_VideoData *viddata = ((SDL_VideoData *)video_device->driverdata);
+    struct gbm_bo *bo;
+    uint8_t *ready_buffer;
+    size_t bo_stride, bufsize;
+    int i, w, h;
+
+    if (curdata->bo) {
+        return curdata->bo;
+    }
+
+    if (dispdata->cursor_bo_drm_fd < 0) {
+        SDL_SetError("Cursor or display not initialized properly.");
+        return NULL;
+    }
+
+    bo = KMSDRM_gbm_bo_create(viddata->gbm_dev,
         dispdata->cursor_w, dispdata->cursor_h,
         GBM_FORMAT_ARGB8888, GBM_BO_USE_CURSOR | GBM_BO_USE_WRITE | GBM_BO_USE_LINEAR);
-
-    if (!dispdata->cursor_bo) {
+    if (!bo) {
         SDL_SetError("Could not create GBM cursor BO");
-        return;
+        return NULL;
     }
 
-    dispdata->cursor_bo_drm_fd = viddata->drm_fd;
-} 
+    /* Prepare a buffer we can dump to our GBM BO (different
+       size, alpha premultiplication...) */
+    bo_stride = KMSDRM_gbm_bo_get_stride(bo);
+    bufsize = bo_stride * dispdata->cursor_h;
+
+    ready_buffer = (uint8_t*)SDL_calloc(1, bufsize);
+    if (!ready_buffer) {
+        KMSDRM_gbm_bo_destroy(bo);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    /* Copy from the cursor buffer to a buffer that we can dump to the GBM BO. */
+    w = SDL_min(curdata->w, (int)dispdata->cursor_w);
+    h = SDL_min(curdata->h, (int)dispdata->cursor_h);
+    for (i = 0; i < h; i++) {
+        SDL_memcpy(ready_buffer + (i * bo_stride), &curdata->buffer[i * curdata->buffer_pitch], 4 * w);
+    }
+
+    /* Dump the cursor buffer to our GBM BO. */
+    if (KMSDRM_gbm_bo_write(bo, ready_buffer, bufsize)) {
+        SDL_free(ready_buffer);
+        KMSDRM_gbm_bo_destroy(bo);
+        SDL_SetError("Could not write to GBM cursor BO");
+        return NULL;
+    }
+
+    SDL_free(ready_buffer);
+
+    curdata->bo = bo;
+    return bo;
+}
 
 /* Remove a cursor buffer from a display's DRM cursor BO. */
 static int
@@ -130,6 +218,12 @@ KMSDRM_RemoveCursorFromBO(SDL_VideoDisplay *display)
     SDL_VideoDevice *video_device = SDL_GetVideoDevice();
     SDL_VideoData *viddata = ((SDL_VideoData *)video_device->driverdata);
 
+    dispdata->cursor_bo = NULL;
+
+    if (KMSDRM_HasAtomicCursor(dispdata)) {
+        return KMSDRM_AtomicSetCursor(video_device, dispdata, NULL, 0, 0);
+    }
+
     ret = KMSDRM_drmModeSetCursor(viddata->drm_fd,
         dispdata->crtc->crtc_id, 0, 0, 0);
 
@@ -140,77 +234,52 @@ KMSDRM_RemoveCursorFromBO(SDL_VideoDisplay *display)
     return ret;
 }
 
-/* Dump a cursor buffer to a display's DRM cursor BO.  */
+/* Put a cursor's BO on a display. The pixels are already there, so this
+   is just a matter of pointing the cursor plane at it. */
 static int
-KMSDRM_DumpCursorToBO(SDL_VideoDisplay *display, SDL_Cursor *cursor)
+KMSDRM_ShowCursorBO(SDL_VideoDisplay *display, SDL_Cursor *cursor)
 {
     SDL_DisplayData *dispdata = (SDL_DisplayData *) display->driverdata;
     KMSDRM_CursorData *curdata = (KMSDRM_CursorData *) cursor->driverdata;
     SDL_VideoDevice *video_device = SDL_GetVideoDevice();
     SDL_VideoData *viddata = ((SDL_VideoData *)video_device->driverdata);
-
+    struct gbm_bo *bo;
     uint32_t bo_handle;
-    size_t bo_stride;
-    size_t bufsize;
-    uint8_t *ready_buffer = NULL;
-    uint8_t *src_row;
-
-    int i;
     int ret;
 
-    if (!curdata || !dispdata->cursor_bo) {
+    if (!curdata) {
         return SDL_SetError("Cursor or display not initialized properly.");
     }
 
-    /* Prepare a buffer we can dump to our GBM BO (different
-       size, alpha premultiplication...) */
-    bo_stride = KMSDRM_gbm_bo_get_stride(dispdata->cursor_bo);
-    bufsize = bo_stride * dispdata->cursor_h;
-
-    ready_buffer = (uint8_t*)SDL_calloc(1, bufsize);
-
-    if (!ready_buffer) {
-        ret = SDL_OutOfMemory();
-        goto cleanup;
-    }
-
-    /* Copy from the cursor buffer to a buffer that we can dump to the GBM BO. */
-    for (i = 0; i < curdata->h; i++) {
-        src_row = &((uint8_t*)curdata->buffer)[i * curdata->w * 4];
-        SDL_memcpy(ready_buffer + (i * bo_stride), src_row, 4 * curdata->w);
-    }
-
-    /* Dump the cursor buffer to our GBM BO. */
-    if (KMSDRM_gbm_bo_write(dispdata->cursor_bo, ready_buffer, bufsize)) {
-        ret = SDL_SetError("Could not write to GBM cursor BO");
-        goto cleanup;
+    bo = KMSDRM_GetCursorBO(dispdata, curdata);
+    if (!bo) {
+        return -1;
     }
 
     /* Put the GBM BO buffer on screen using the DRM interface. */
-    bo_handle = KMSDRM_gbm_bo_get_handle(dispdata->cursor_bo).u32;
-    if (curdata->hot_x == 0 && curdata->hot_y == 0) {
-        ret = KMSDRM_drmModeSetCursor(viddata->drm_fd, dispdata->crtc->crtc_id,
-            bo_handle, dispdata->cursor_w, dispdata->cursor_h);
+    if (KMSDRM_HasAtomicCursor(dispdata)) {
+        SDL_Mouse *mouse = SDL_GetMouse();
+        ret = KMSDRM_AtomicSetCursor(video_device, dispdata, bo,
+                                     mouse->x - curdata->hot_x, mouse->y - curdata->hot_y);
     } else {
-        ret = KMSDRM_drmModeSetCursor2(viddata->drm_fd, dispdata->crtc->crtc_id,
-            bo_handle, dispdata->cursor_w, dispdata->cursor_h, curdata->hot_x, curdata->hot_y);
-    }
+        bo_handle = KMSDRM_gbm_bo_get_handle(bo).u32;
+        if (curdata->hot_x == 0 && curdata->hot_y == 0) {
+            ret = KMSDRM_drmModeSetCursor(viddata->drm_fd, dispdata->crtc->crtc_id,
+                bo_handle, dispdata->cursor_w, dispdata->cursor_h);
+        } else {
+            ret = KMSDRM_drmModeSetCursor2(viddata->drm_fd, dispdata->crtc->crtc_id,
+                bo_handle, dispdata->cursor_w, dispdata->cursor_h, curdata->hot_x, curdata->hot_y);
+        }
 
-    if (ret) {
-        ret = SDL_SetError("Failed to set DRM cursor.");
-        goto cleanup;
+        if (ret) {
+            ret = SDL_SetError("Failed to set DRM cursor.");
+        }
     }
 
-    if (ret) {
-        ret = SDL_SetError("Failed to reset cursor position.");
-        goto cleanup;
+    if (ret == 0) {
+        dispdata->cursor_bo = bo;
     }
 
-cleanup:
-
-    if (ready_buffer) {
-        SDL_free(ready_buffer);
-    }
     return ret;
 }
 
@@ -219,10 +288,23 @@ static void
 KMSDRM_FreeCursor(SDL_Cursor * cursor)
 {
     KMSDRM_CursorData *curdata;
+    int i;
 
     /* Even if the cursor is not ours, free it. */
     if (cursor) {
         curdata = (KMSDRM_CursorData *) cursor->driverdata;
+        /* Take it off any display still showing it, then free its BO */
+        if (curdata->bo) {
+            for (i = 0; i < SDL_GetNumVideoDisplays(); i++) {
+                SDL_VideoDisplay *display = SDL_GetDisplay(i);
+                SDL_DisplayData *dispdata = (SDL_DisplayData *) display->driverdata;
+                if (dispdata->cursor_bo == curdata->bo) {
+                    KMSDRM_RemoveCursorFromBO(display);
+                }
+            }
+            KMSDRM_gbm_bo_destroy(curdata->bo);
+            curdata->bo = NULL;
+        }
         /* Free cursor buffer */
         if (curdata->buffer) {
             SDL_free(curdata->buffer);
@@ -244,6 +326,7 @@ KMSDRM_CreateCursor(SDL_Surface * surface, int hot_x, int hot_y)
 {
     KMSDRM_CursorData *curdata;
     SDL_Cursor *cursor, *ret;
+    SDL_VideoDisplay *display;
 
     curdata = NULL;
     ret = NULL;
@@ -285,6 +368,13 @@ KMSDRM_CreateCursor(SDL_Surface * surface, int hot_x, int hot_y)
                          surface->format->format, surface->pixels, surface->pitch,
                          SDL_PIXELFORMAT_ARGB8888, curdata->buffer, surface->w * 4);
 
+    /* Get the BO ready now, so showing the cursor is quick. If there's no
+       display ready for cursors yet, ShowCursor() will do it. */
+    display = SDL_GetMouse()->focus ? SDL_GetDisplayForWindow(SDL_GetMouse()->focus) : NULL;
+    if (display && ((SDL_DisplayData *) display->driverdata)->cursor_bo_drm_fd >= 0) {
+        KMSDRM_GetCursorBO((SDL_DisplayData *) display->driverdata, curdata);
+    }
+
     cursor->driverdata = curdata;
 
     ret = cursor;
@@ -351,7 +441,7 @@ KMSDRM_ShowCursor(SDL_Cursor * cursor)
             if (cursor) {
                 /* Dump the cursor to the display DRM cursor BO so it becomes visible
                    on that display. */
-                ret = KMSDRM_DumpCursorToBO(display, cursor);
+                ret = KMSDRM_ShowCursorBO(display, cursor);
 
             } else {
                 /* Hide the cursor on that display. */
@@ -386,9 +476,19 @@ KMSDRM_WarpMouseGlobal(int x, int y)
         SDL_SendMouseMotion(mouse->focus, mouse->mouseID, 0, x, y);
 
         /* And now update the cursor graphic position on screen. */
-        if (dispdata->cursor_bo) {
+        if (dispdata->cursor_bo_drm_fd >= 0) {
             int ret = 0;
 
+            if (!dispdata->cursor_bo) {
+                return 0;   /* Hidden, it'll show up in the right place */
+            }
+
+            if (KMSDRM_HasAtomicCursor(dispdata)) {
+                KMSDRM_CursorData *curdata = (KMSDRM_CursorData *) mouse->cur_cursor->driverdata;
+                return KMSDRM_AtomicMoveCursor(SDL_GetVideoDevice(), dispdata,
+                                               x - curdata->hot_x, y - curdata->hot_y);
+            }
+
             ret = KMSDRM_drmModeMoveCursor(dispdata->cursor_bo_drm_fd, dispdata->crtc->crtc_id, x, y);
 
             if (ret) {
@@ -447,11 +547,22 @@ KMSDRM_MoveCursor(SDL_Cursor * cursor)
         SDL_Window *window = mouse->focus;
         SDL_DisplayData *dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
 
-        if (!dispdata->cursor_bo) {
+        if (dispdata->cursor_bo_drm_fd < 0) {
             SDL_SetError("Cursor not initialized properly.");
             return;
         }
 
+        if (!dispdata->cursor_bo) {
+            return;
+        }
+
+        if (KMSDRM_HasAtomicCursor(dispdata)) {
+            KMSDRM_CursorData *curdata = (KMSDRM_CursorData *) mouse->cur_cursor->driverdata;
+            KMSDRM_AtomicMoveCursor(SDL_GetVideoDevice(), dispdata,
+                                    mouse->x - curdata->hot_x, mouse->y - curdata->hot_y);
+            return;
+        }
+
         ret = KMSDRM_drmModeMoveCursor(dispdata->cursor_bo_drm_fd, dispdata->crtc->crtc_id, mouse->x, mouse->y);
 
         if (ret) {
@@ -36,11 +36,17 @@ typedef struct _KMSDRM_CursorData
 
     /* The buffer where we store the mouse bitmap ready to be used.
        We get it ready and filled in CreateCursor(), and copy it
-       to a GBM BO in ShowCursor().*/     
+       to the cursor's GBM BO when it's made. */
     uint32_t *buffer;
     size_t buffer_size;
     size_t buffer_pitch;
 
+    /* The buffer, padded to the hardware cursor size, in a BO of its own so
+       showing the cursor is just pointing the CRTC at it. Made as soon as
+       there's a GBM device, and dropped with it: the buffer stays around to
+       make it again. */
+    struct gbm_bo *bo;
+
 } KMSDRM_CursorData;
 
 extern void KMSDRM_InitMouse(_THIS, SDL_VideoDisplay *display);
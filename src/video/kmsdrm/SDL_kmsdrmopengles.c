@@ -29,6 +29,7 @@
 #include "SDL_kmsdrmopengles.h"
 #include "SDL_kmsdrmdyn.h"
 #include "SDL_kmsdrmblitter.h"
+#include "SDL_kmsdrmatomic.h"
 #include <errno.h>
 
 #ifndef EGL_PLATFORM_GBM_MESA
@@ -75,20 +76,24 @@ int KMSDRM_GLES_SetSwapInterval(_THIS, int interval) {
         return SDL_SetError("EGL not initialized");
     }
 
-    if (interval == 0 || interval == 1) {
+    /* -1 is mailbox mode: SwapWindow never blocks, and the blitter presents
+       the newest frame on each vblank. Without the blitter, it's like 1. */
+    if (interval >= -1 && interval <= 1) {
         _this->egl_data->egl_swapinterval = interval;
     } else {
-        return SDL_SetError("Only swap intervals of 0 or 1 are supported");
+        return SDL_SetError("Only swap intervals of -1, 0 or 1 are supported");
     }
 
     return 0;
 }
 
-int
-KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SDL_VideoData *viddata, struct gbm_bo *bo, struct gbm_bo *next_bo)
+static int
+KMSDRM_PresentBO(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SDL_VideoData *viddata, struct gbm_bo *bo, struct gbm_bo *next_bo,
+                 const KMSDRM_Damage *damage, int fence_fd)
 {
     int ret = 0;
     KMSDRM_FBInfo *fb_info;
+    SDL_bool async_flip;
 
     /* Always wait for the previous issued flip before issuing a new one,
        even if you do async flips. */
@@ -101,6 +106,37 @@ KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SD
         return 0;
     }
 
+    /* Recorded for capture once it's on screen */
+    KMSDRM_CaptureSubmit(&windata->capture, next_bo);
+
+    /* Atomic commits can't do async flips on most kernels, so tearing
+       updates (swap interval 0) stay on drmModePageFlip(). With plane
+       scaling the first frame still has to be atomic, SetCrtc can't scale,
+       but later legacy flips keep the plane's rectangles. Clones only
+       follow atomic commits, so windows with clones never flip async. */
+    async_flip = (_this->egl_data->egl_swapinterval == 0 && viddata->async_pageflip_support &&
+                  windata->num_clones == 0);
+
+    if (dispdata->atomic && (!async_flip || (windata->plane_scaling && !bo))) {
+        ret = KMSDRM_AtomicCommitFrame(_this, windata, dispdata, next_bo, fb_info, !bo, damage, fence_fd);
+
+        /* If the TEST_ONLY probe didn't pass, dispdata->atomic is now unset
+           and we go on with the legacy path below. */
+        if (dispdata->atomic) {
+            if (ret == 0 && windata->double_buffer && !KMSDRM_WaitPageflip(_this, windata)) {
+                SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Immediate wait for previous pageflip failed");
+            }
+            return ret;
+        }
+    }
+
+    if (windata->plane_scaling && !dispdata->atomic) {
+        /* The app's buffers aren't screen-sized, so the legacy path can't
+           show them: recreate the surfaces with the blitter on next swap. */
+        windata->egl_surface_dirty = SDL_TRUE;
+        return 0;
+    }
+
     if (!bo) {
         /* On the first swap, immediately present the new front buffer. Before
            drmModePageFlip can be used the CRTC has to be configured to use
@@ -113,6 +149,8 @@ KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SD
             SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not set videomode on CRTC: (%d).", ret);
             return 0;
         }
+
+        dispdata->atomic_mode = dispdata->mode;
     } else {
         /* On subsequent swaps, queue the new front buffer to be flipped during
            the next vertical blank
@@ -126,12 +164,13 @@ KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SD
            That makes it flip immediately, without waiting for the next vblank
            to do so, so even if we don't block on EGL, the flip will have completed
            when we get here again. */
-        if (_this->egl_data->egl_swapinterval == 0 && viddata->async_pageflip_support) {
+        if (async_flip) {
             flip_flags |= DRM_MODE_PAGE_FLIP_ASYNC;
         }
 
+        KMSDRM_TimingSubmit(&windata->timing);
         ret = KMSDRM_drmModePageFlip(viddata->drm_fd, dispdata->crtc->crtc_id,
-                 fb_info->fb_id, flip_flags, &windata->waiting_for_flip);
+                 fb_info->fb_id, flip_flags, windata);
 
         if (ret == 0) {
             windata->waiting_for_flip = SDL_TRUE;
@@ -159,47 +198,182 @@ KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SD
     return ret;
 }
 
+/* The fence FD, if not -1, signals when the GPU is done with next_bo. It
+   goes to the kernel with atomic commits; legacy flips rely on implicit
+   sync. Either way, it's closed here. */
 int
-KMSDRM_GLES_SwapWindow(_THIS, SDL_Window * window) {
+KMSDRM_Post_gbm_bo(_THIS, SDL_WindowData *windata, SDL_DisplayData *dispdata, SDL_VideoData *viddata, struct gbm_bo *bo, struct gbm_bo *next_bo,
+                   const KMSDRM_Damage *damage, int fence_fd)
+{
+    int ret = KMSDRM_PresentBO(_this, windata, dispdata, viddata, bo, next_bo, damage, fence_fd);
+
+    if (fence_fd >= 0) {
+        close(fence_fd);
+    }
+
+    return ret;
+}
+
+/* A native fence for the rendering queued so far, for the kernel to wait
+   on instead of us. Only when it can be used: explicit sync, and a plane
+   that takes IN_FENCE_FD. */
+static EGLSyncKHR
+KMSDRM_GLES_CreateOutFence(_THIS, SDL_DisplayData *dispdata)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+
+    if (!viddata->explicit_sync || !KMSDRM_AtomicHasInFence(dispdata)) {
+        return EGL_NO_SYNC_KHR;
+    }
+
+    return _this->egl_data->eglCreateSyncKHR(_this->egl_data->egl_display,
+                                             EGL_SYNC_NATIVE_FENCE_ANDROID, NULL);
+}
+
+/* The FD of a native fence can only be had once it's flushed, i.e. after
+   the swap. The sync object isn't needed after that. */
+static int
+KMSDRM_GLES_GetFenceFD(_THIS, EGLSyncKHR fence)
+{
+    int fd;
+
+    if (fence == EGL_NO_SYNC_KHR) {
+        return -1;
+    }
+
+    fd = _this->egl_data->eglDupNativeFenceFDANDROID(_this->egl_data->egl_display, fence);
+    _this->egl_data->eglDestroySyncKHR(_this->egl_data->egl_display, fence);
+
+    return (fd == EGL_NO_NATIVE_FENCE_FD_ANDROID) ? -1 : fd;
+}
+
+/* Finish the app's frame, telling EGL what changed when it can take it. */
+static EGLBoolean
+KMSDRM_GLES_SwapBuffers(_THIS, SDL_Window * window, const KMSDRM_Damage *damage)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
     SDL_WindowData *windata = ((SDL_WindowData *) window->driverdata);
-    SDL_DisplayData *dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
+    EGLint rects[KMSDRM_MAX_DAMAGE_RECTS * 4];
+    int i;
+
+    if (damage->partial && damage->num_rects > 0 && viddata->eglSwapBuffersWithDamage) {
+        /* EGL wants them with a bottom-left origin */
+        for (i = 0; i < damage->num_rects; i++) {
+            rects[i * 4 + 0] = damage->rects[i].x;
+            rects[i * 4 + 1] = window->h - damage->rects[i].y - damage->rects[i].h;
+            rects[i * 4 + 2] = damage->rects[i].w;
+            rects[i * 4 + 3] = damage->rects[i].h;
+        }
+        return viddata->eglSwapBuffersWithDamage(_this->egl_data->egl_display, windata->egl_surface,
+                                                 rects, damage->num_rects);
+    }
+
+    return _this->egl_data->eglSwapBuffers(_this->egl_data->egl_display, windata->egl_surface);
+}
+
+/* A frame that's identical to the one on screen isn't presented at all,
+   but with vsync the app still expects to be held until the next vblank. */
+static void
+KMSDRM_GLES_WaitVBlank(_THIS, SDL_DisplayData *dispdata)
+{
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
-    KMSDRM_Blitter *blitter = windata->blitter;
+    unsigned int type = DRM_VBLANK_RELATIVE;
+    drmVBlank vbl;
 
-    /* Recreate the GBM / EGL surfaces if the display mode has changed */
-    if (windata->egl_surface_dirty) {
-        KMSDRM_CreateSurfaces(_this, window);
+    if (_this->egl_data->egl_swapinterval <= 0) {
+        return;
+    }
+
+    if (dispdata->crtc_index == 1) {
+        type |= DRM_VBLANK_SECONDARY;
+    } else if (dispdata->crtc_index > 1) {
+        type |= (dispdata->crtc_index << DRM_VBLANK_HIGH_CRTC_SHIFT) & DRM_VBLANK_HIGH_CRTC_MASK;
+    }
+
+    SDL_zero(vbl);
+    vbl.request.type = (drmVBlankSeqType)type;
+    vbl.request.sequence = 1;
+    if (KMSDRM_drmWaitVBlank(viddata->drm_fd, &vbl) != 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "drmWaitVBlank failed: %d", errno);
+    }
+}
+
+/* With the blitter, the app's front buffers belong to the blitter thread
+   until it hands them back, so they're not tracked in windata->bo/next_bo.
+   Swap interval -1 is mailbox mode: this never blocks, and a frame that
+   hasn't been presented yet is replaced by the new one. */
+static int
+KMSDRM_GLES_SwapWindowBlitter(_THIS, SDL_Window * window, KMSDRM_Blitter *blitter, Uint64 swap_ns,
+                              const KMSDRM_Damage *damage)
+{
+    SDL_WindowData *windata = ((SDL_WindowData *) window->driverdata);
+    EGLSyncKHR fence;
+    struct gbm_bo *bo;
+
+    /* Give EGL back the buffers the blitter is done with before it looks
+       for a free one. */
+    KMSDRM_BlitterReleaseBuffers(blitter, windata->gs);
+
+    fence = _this->egl_data->eglCreateSyncKHR(_this->egl_data->egl_display,
+                                              EGL_SYNC_FENCE_KHR, NULL);
+
+    if (!KMSDRM_GLES_SwapBuffers(_this, window, damage)) {
+        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "eglSwapBuffers failed");
+        _this->egl_data->eglDestroySyncKHR(_this->egl_data->egl_display, fence);
+        return 0;
     }
 
+    bo = KMSDRM_gbm_surface_lock_front_buffer(windata->gs);
+    if (!bo) {
+        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not lock front buffer on GBM surface");
+        _this->egl_data->eglDestroySyncKHR(_this->egl_data->egl_display, fence);
+        return 0;
+    }
+
+    KMSDRM_BlitterQueue(blitter, windata->gs, bo, fence, swap_ns, damage,
+                        (_this->egl_data->egl_swapinterval < 0));
+    return 1;
+}
+
+static int
+KMSDRM_GLES_SwapWindowDirect(_THIS, SDL_Window * window, Uint64 swap_ns, const KMSDRM_Damage *damage)
+{
+    SDL_WindowData *windata = ((SDL_WindowData *) window->driverdata);
+    SDL_DisplayData *dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    EGLSyncKHR fence;
+    int fence_fd;
+
+    KMSDRM_TimingSwap(&windata->timing, swap_ns);
+
     /* Wait for confirmation that the next front buffer has been flipped, at which
        point the previous front buffer can be released */
-    if (blitter) {
-        /* If we're using the blitter, we wait for an available buffer and then fence it */
-        SDL_LockMutex(blitter->mutex);
-        blitter->planes[blitter->next].fence = _this->egl_data->eglCreateSyncKHR(
-            _this->egl_data->egl_display,
-            EGL_SYNC_FENCE_KHR,
-            NULL);
-    } else if (!KMSDRM_WaitPageflip(_this, windata)) {
+    if (!KMSDRM_WaitPageflip(_this, windata)) {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Wait for previous pageflip failed");
         return 0;
     }
 
-    /* Release the previous front buffer */
+    /* Release the previous front buffer, unless it's retained for capture,
+       and give back the retained ones that aren't anymore. */
     if (windata->bo) {
-        KMSDRM_gbm_surface_release_buffer(windata->gs, windata->bo);
+        KMSDRM_CaptureReleaseBuffer(&windata->capture, windata->gs, windata->bo);
         windata->bo = NULL;
     }
+    KMSDRM_CaptureCollect(&windata->capture, windata->gs);
 
     windata->bo = windata->next_bo;
 
     /* Mark a buffer to becume the next front buffer.
        This won't happen until pagelip completes. */
-    if (!(_this->egl_data->eglSwapBuffers(_this->egl_data->egl_display,
-                                           windata->egl_surface))) {
+    fence = KMSDRM_GLES_CreateOutFence(_this, dispdata);
+    if (!KMSDRM_GLES_SwapBuffers(_this, window, damage)) {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "eglSwapBuffers failed");
+        if (fence != EGL_NO_SYNC_KHR) {
+            _this->egl_data->eglDestroySyncKHR(_this->egl_data->egl_display, fence);
+        }
         return 0;
     }
+    fence_fd = KMSDRM_GLES_GetFenceFD(_this, fence);
 
     /* From the GBM surface, get the next BO to become the next front buffer,
        and lock it so it can't be allocated as a back buffer (to prevent EGL
@@ -207,20 +381,91 @@ KMSDRM_GLES_SwapWindow(_THIS, SDL_Window * window) {
     windata->next_bo = KMSDRM_gbm_surface_lock_front_buffer(windata->gs);
     if (!windata->next_bo) {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not lock front buffer on GBM surface");
+        if (fence_fd >= 0) {
+            close(fence_fd);
+        }
         return 0;
     }
 
-    /* Either buffer object to the blitter or post directly to kmsdrm */
-    if (blitter) {
-        blitter->planes[blitter->next].bo = windata->next_bo;
-        SDL_CondSignal(blitter->cond);
-        SDL_UnlockMutex(blitter->mutex);
-        return 1;
+    /* The app's BO is the FB, so its damage goes to the display as is */
+    return KMSDRM_Post_gbm_bo(_this, windata, dispdata, viddata, windata->bo, windata->next_bo,
+                              damage, fence_fd);
+}
+
+int
+KMSDRM_GLES_SwapWindow(_THIS, SDL_Window * window) {
+    SDL_WindowData *windata = ((SDL_WindowData *) window->driverdata);
+    SDL_DisplayData *dispdata;
+    Uint64 swap_ns = KMSDRM_TimingNow();
+    KMSDRM_Damage damage;
+    int ret;
+
+    KMSDRM_TimingPaceSwap(&windata->timing, swap_ns);
+
+    /* The damage is only good for this swap */
+    damage = windata->damage;
+    windata->damage.partial = SDL_FALSE;
+    windata->damage.num_rects = 0;
+
+    /* Recreate the GBM / EGL surfaces if the display mode has changed */
+    if (windata->egl_surface_dirty) {
+        KMSDRM_CreateSurfaces(_this, window);
+    }
+
+    dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
+
+    /* Nothing changed: if the screen already shows it, skip the blit and
+       the flip, and leave the app's back buffer as it is. */
+    if (damage.partial && damage.num_rects == 0) {
+        if (windata->presented) {
+            KMSDRM_GLES_WaitVBlank(_this, dispdata);
+            KMSDRM_TimingPace(&windata->timing, swap_ns, SDL_FALSE);
+            return 1;
+        }
+        damage.partial = SDL_FALSE;
+    }
+
+    /* Surfaces were maybe just recreated. A blitter that's parked while
+       the plane scales the app's buffers stays out of the way. */
+    if (windata->blitter && !windata->plane_scaling) {
+        ret = KMSDRM_GLES_SwapWindowBlitter(_this, window, windata->blitter, swap_ns, &damage);
     } else {
-        return KMSDRM_Post_gbm_bo(_this, windata, dispdata, viddata, windata->bo, windata->next_bo);
+        ret = KMSDRM_GLES_SwapWindowDirect(_this, window, swap_ns, &damage);
+    }
+
+    if (ret) {
+        windata->presented = SDL_TRUE;
     }
 
+    /* Hold the app back if it's enabled, so it starts its next frame just in time.
+       With VRR there are no fixed vblanks to aim for: frames go out when ready.
+       Mailbox (-1) never blocks the app, so it's never paced either. */
+    KMSDRM_TimingPace(&windata->timing, swap_ns,
+                      (_this->egl_data->egl_swapinterval > 0 && !dispdata->vrr_enabled));
+
+    return ret;
+}
+
+#ifdef __LINUX__
+int
+KMSDRM_SetSwapDamage(_THIS, SDL_Window * window, const SDL_Rect * rects, int count)
+{
+    SDL_WindowData *windata = ((SDL_WindowData *) window->driverdata);
+    int i;
+
+    if (!windata || !windata->gs) {
+        return SDL_SetError("Window has no GL surface");
+    }
+
+    windata->damage.partial = (rects != NULL);
+    windata->damage.num_rects = 0;
+    for (i = 0; rects && i < count; i++) {
+        KMSDRM_AddDamage(&windata->damage, &rects[i], window->w, window->h);
+    }
+
+    return 0;
 }
+#endif /* __LINUX__ */
 
 SDL_EGL_MakeCurrent_impl(KMSDRM)
 
@@ -33,6 +33,12 @@
 #define SDL_KMSDRM_SYM_CONST(type, name)
 #endif
 
+/* Symbols that may be missing from older libraries without making the
+   module unusable: check KMSDRM_fn for NULL before calling them. */
+#ifndef SDL_KMSDRM_SYM_OPT
+#define SDL_KMSDRM_SYM_OPT(rc,fn,params)
+#endif
+
 
 SDL_KMSDRM_MODULE(LIBDRM)
 SDL_KMSDRM_SYM(void,drmModeFreeResources,(drmModeResPtr ptr))
@@ -42,6 +48,7 @@ SDL_KMSDRM_SYM(void,drmModeFreeConnector,(drmModeConnectorPtr ptr))
 SDL_KMSDRM_SYM(void,drmModeFreeEncoder,(drmModeEncoderPtr ptr))
 SDL_KMSDRM_SYM(int,drmGetCap,(int fd, uint64_t capability, uint64_t *value))
 SDL_KMSDRM_SYM(int,drmSetMaster,(int fd))
+SDL_KMSDRM_SYM(int,drmDropMaster,(int fd))
 SDL_KMSDRM_SYM(int,drmAuthMagic,(int fd, drm_magic_t magic))
 SDL_KMSDRM_SYM(drmModeResPtr,drmModeGetResources,(int fd))
 SDL_KMSDRM_SYM(int,drmModeAddFB,(int fd, uint32_t width, uint32_t height, uint8_t depth,
@@ -74,6 +81,8 @@ SDL_KMSDRM_SYM(drmModeConnectorPtr,drmModeGetConnector,(int fd, uint32_t connect
 SDL_KMSDRM_SYM(int,drmHandleEvent,(int fd,drmEventContextPtr evctx))
 SDL_KMSDRM_SYM(int,drmModePageFlip,(int fd, uint32_t crtc_id, uint32_t fb_id,
                                     uint32_t flags, void *user_data))
+SDL_KMSDRM_SYM(int,drmIoctl,(int fd, unsigned long request, void *arg))
+SDL_KMSDRM_SYM(int,drmWaitVBlank,(int fd, drmVBlankPtr vbl))
 
 /* Planes stuff. */
 SDL_KMSDRM_SYM(int,drmSetClientCap,(int fd, uint64_t capability, uint64_t value))
@@ -94,6 +103,36 @@ SDL_KMSDRM_SYM(int,drmModeSetPlane,(int fd, uint32_t plane_id, uint32_t crtc_id,
                                     uint32_t src_w, uint32_t src_h))
 /* Planes stuff ends. */
 
+/* Atomic modesetting stuff. */
+SDL_KMSDRM_SYM(int,drmModeObjectSetProperty,(int fd, uint32_t object_id,
+                                             uint32_t object_type, uint32_t property_id,
+                                             uint64_t value))
+SDL_KMSDRM_SYM(drmModeAtomicReqPtr,drmModeAtomicAlloc,(void))
+SDL_KMSDRM_SYM(void,drmModeAtomicFree,(drmModeAtomicReqPtr req))
+SDL_KMSDRM_SYM(int,drmModeAtomicGetCursor,(drmModeAtomicReqPtr req))
+SDL_KMSDRM_SYM(void,drmModeAtomicSetCursor,(drmModeAtomicReqPtr req, int cursor))
+SDL_KMSDRM_SYM(int,drmModeAtomicMerge,(drmModeAtomicReqPtr base,
+                                       drmModeAtomicReqPtr augment))
+SDL_KMSDRM_SYM(int,drmModeAtomicAddProperty,(drmModeAtomicReqPtr req,
+                                             uint32_t object_id,
+                                             uint32_t property_id,
+                                             uint64_t value))
+SDL_KMSDRM_SYM(int,drmModeAtomicCommit,(int fd, drmModeAtomicReqPtr req,
+                                        uint32_t flags, void *user_data))
+SDL_KMSDRM_SYM(int,drmModeCreatePropertyBlob,(int fd, const void *data, size_t size,
+                                              uint32_t *id))
+SDL_KMSDRM_SYM(int,drmModeDestroyPropertyBlob,(int fd, uint32_t id))
+SDL_KMSDRM_SYM(drmModePropertyBlobPtr,drmModeGetPropertyBlob,(int fd, uint32_t blob_id))
+SDL_KMSDRM_SYM(void,drmModeFreePropertyBlob,(drmModePropertyBlobPtr ptr))
+/* Atomic modesetting stuff ends. */
+
+/* Format modifiers, libdrm 2.4.81 */
+SDL_KMSDRM_SYM_OPT(int,drmModeAddFB2WithModifiers,(int fd, uint32_t width, uint32_t height,
+                                                   uint32_t pixel_format, const uint32_t bo_handles[4],
+                                                   const uint32_t pitches[4], const uint32_t offsets[4],
+                                                   const uint64_t modifier[4], uint32_t *buf_id,
+                                                   uint32_t flags))
+
 SDL_KMSDRM_MODULE(GBM)
 SDL_KMSDRM_SYM(int,gbm_device_is_format_supported,(struct gbm_device *gbm,
                                                    uint32_t format, uint32_t usage))
@@ -121,10 +160,23 @@ SDL_KMSDRM_SYM(void,gbm_surface_destroy,(struct gbm_surface *surf))
 SDL_KMSDRM_SYM(struct gbm_bo *,gbm_surface_lock_front_buffer,(struct gbm_surface *surf))
 SDL_KMSDRM_SYM(void,gbm_surface_release_buffer,(struct gbm_surface *surf, struct gbm_bo *bo))
 
+/* Format modifiers and multi-planar BOs, Mesa 17.1 */
+SDL_KMSDRM_SYM_OPT(struct gbm_surface *,gbm_surface_create_with_modifiers,(struct gbm_device *gbm,
+                                                                           uint32_t width, uint32_t height,
+                                                                           uint32_t format,
+                                                                           const uint64_t *modifiers,
+                                                                           const unsigned int count))
+SDL_KMSDRM_SYM_OPT(uint64_t,gbm_bo_get_modifier,(struct gbm_bo *bo))
+SDL_KMSDRM_SYM_OPT(int,gbm_bo_get_plane_count,(struct gbm_bo *bo))
+SDL_KMSDRM_SYM_OPT(union gbm_bo_handle,gbm_bo_get_handle_for_plane,(struct gbm_bo *bo, int plane))
+SDL_KMSDRM_SYM_OPT(uint32_t,gbm_bo_get_stride_for_plane,(struct gbm_bo *bo, int plane))
+SDL_KMSDRM_SYM_OPT(uint32_t,gbm_bo_get_offset,(struct gbm_bo *bo, int plane))
+
 
 #undef SDL_KMSDRM_MODULE
 #undef SDL_KMSDRM_SYM
 #undef SDL_KMSDRM_SYM_CONST
+#undef SDL_KMSDRM_SYM_OPT
 
 /* *INDENT-ON* */ /* clang-format on */
 
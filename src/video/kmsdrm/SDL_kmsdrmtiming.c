@@ -0,0 +1,270 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_KMSDRM
+
+#include "SDL_log.h"
+
+#include "SDL_kmsdrmvideo.h"
+#include "SDL_kmsdrmtiming.h"
+
+#include <errno.h>
+#include <time.h>
+
+#define KMSDRM_NS_PER_SECOND 1000000000ULL
+
+/* How often the timing summary is logged, at debug priority */
+#define KMSDRM_TIMING_SUMMARY_NS (5 * KMSDRM_NS_PER_SECOND)
+
+/* Slack left by the frame pacer between the predicted end of a frame and
+   its deadline, to absorb scheduling jitter. */
+#define KMSDRM_PACING_MARGIN_NS 2000000ULL
+
+/* Track the peak of a duration, slowly decaying so that one slow frame
+   doesn't keep the estimate high forever. */
+#define KMSDRM_DECAYING_PEAK(est, sample) \
+    ((est) = SDL_max((sample), (est) - (est) / 16))
+
+/* Page flip timestamps are CLOCK_MONOTONIC, as long as DRM_CAP_TIMESTAMP_MONOTONIC
+   is set, which it is on every kernel since 3.8. */
+Uint64
+KMSDRM_TimingNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Uint64)ts.tv_sec * KMSDRM_NS_PER_SECOND + ts.tv_nsec;
+}
+
+void
+KMSDRM_TimingSetMode(KMSDRM_FrameTimes *timing, const drmModeModeInfo *mode)
+{
+    SDL_AtomicLock(&timing->lock);
+
+    /* The exact period, vrefresh is rounded to an integer */
+    if (mode->clock && mode->htotal && mode->vtotal) {
+        timing->refresh_ns = (Uint64)mode->htotal * mode->vtotal * 1000000 / mode->clock;
+    } else {
+        timing->refresh_ns = 0;
+    }
+
+    /* Flips from the previous mode say nothing about the next vblanks */
+    timing->last_flip_ns = 0;
+
+    SDL_AtomicUnlock(&timing->lock);
+}
+
+void
+KMSDRM_TimingSwap(KMSDRM_FrameTimes *timing, Uint64 swap_ns)
+{
+    SDL_zero(timing->next);
+    timing->next.swap_ns = swap_ns;
+}
+
+void
+KMSDRM_TimingFence(KMSDRM_FrameTimes *timing, Uint64 fence_ns)
+{
+    timing->next.fence_ns = fence_ns;
+}
+
+/* The frame is about to be committed: the first vblank it can make is the
+   one following the last flip we saw, plus as many periods as needed to be
+   in the future. */
+void
+KMSDRM_TimingSubmit(KMSDRM_FrameTimes *timing)
+{
+    Uint64 now = KMSDRM_TimingNow();
+
+    SDL_AtomicLock(&timing->lock);
+
+    timing->next.submit_ns = now;
+    if (timing->next.swap_ns && now > timing->next.swap_ns) {
+        KMSDRM_DECAYING_PEAK(timing->pipeline_ns, now - timing->next.swap_ns);
+    }
+    if (timing->last_flip_ns && timing->refresh_ns && now >= timing->last_flip_ns) {
+        Uint64 periods = (now - timing->last_flip_ns) / timing->refresh_ns + 1;
+        timing->next.target_ns = timing->last_flip_ns + periods * timing->refresh_ns;
+    }
+
+    timing->inflight = timing->next;
+    SDL_zero(timing->next);
+
+    SDL_AtomicUnlock(&timing->lock);
+}
+
+static void
+KMSDRM_TimingSummary(KMSDRM_FrameTimes *timing, const SDL_KMSDRMFrameTiming *frame)
+{
+    Uint64 elapsed;
+
+    if (!timing->summary_start_ns) {
+        timing->summary_start_ns = frame->flip_ns;
+        return;
+    }
+
+    if (frame->swap_ns && frame->flip_ns > frame->swap_ns) {
+        Uint64 latency = frame->flip_ns - frame->swap_ns;
+        timing->summary_latency_ns += latency;
+        timing->summary_max_latency_ns = SDL_max(timing->summary_max_latency_ns, latency);
+    }
+    timing->summary_missed += frame->missed_vblanks;
+    timing->summary_frames++;
+
+    elapsed = frame->flip_ns - timing->summary_start_ns;
+    if (elapsed < KMSDRM_TIMING_SUMMARY_NS) {
+        return;
+    }
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
+                 "KMSDRM: %u frames in %.2f s (%.2f fps), swap to flip %.2f ms avg, %.2f ms max, %u missed vblanks",
+                 (unsigned)timing->summary_frames, elapsed / 1e9,
+                 timing->summary_frames * 1e9 / elapsed,
+                 timing->summary_latency_ns / 1e6 / timing->summary_frames,
+                 timing->summary_max_latency_ns / 1e6,
+                 (unsigned)timing->summary_missed);
+
+    timing->summary_start_ns = frame->flip_ns;
+    timing->summary_latency_ns = 0;
+    timing->summary_max_latency_ns = 0;
+    timing->summary_frames = 0;
+    timing->summary_missed = 0;
+}
+
+/* Called from the page flip handler, with the kernel's vblank counter and
+   timestamp for the flip. */
+void
+KMSDRM_TimingFlip(KMSDRM_FrameTimes *timing, unsigned int sequence,
+                  unsigned int sec, unsigned int usec)
+{
+    SDL_KMSDRMFrameTiming *frame;
+
+    SDL_AtomicLock(&timing->lock);
+
+    frame = &timing->frames[timing->head];
+    *frame = timing->inflight;
+    frame->flip_ns = (Uint64)sec * KMSDRM_NS_PER_SECOND + (Uint64)usec * 1000;
+    frame->sequence = sequence;
+
+    /* Round to the nearest period, timestamps jitter a bit */
+    if (frame->target_ns && timing->refresh_ns &&
+        frame->flip_ns > frame->target_ns + timing->refresh_ns / 2) {
+        frame->missed_vblanks = (Uint32)((frame->flip_ns - frame->target_ns + timing->refresh_ns / 2) /
+                                         timing->refresh_ns);
+    }
+
+    timing->head = (timing->head + 1) % KMSDRM_TIMING_FRAMES;
+    timing->count = SDL_min(timing->count + 1, KMSDRM_TIMING_FRAMES);
+    timing->last_flip_ns = frame->flip_ns;
+    SDL_zero(timing->inflight);
+
+    KMSDRM_TimingSummary(timing, frame);
+
+    SDL_AtomicUnlock(&timing->lock);
+}
+
+void
+KMSDRM_TimingPaceSwap(KMSDRM_FrameTimes *timing, Uint64 swap_ns)
+{
+    if (timing->pacing && timing->last_return_ns && swap_ns > timing->last_return_ns) {
+        KMSDRM_DECAYING_PEAK(timing->app_cost_ns, swap_ns - timing->last_return_ns);
+    }
+}
+
+/* Just in time pacing: the frame swapped at swap_ns will make the first
+   vblank after it gets through the swap pipeline, so the next one has until
+   the vblank after that. Sleep until that deadline, minus what the app and
+   the pipeline need to get a frame there, so input is sampled as late as
+   possible. Only the app's thread ever sleeps here. */
+void
+KMSDRM_TimingPace(KMSDRM_FrameTimes *timing, Uint64 swap_ns, SDL_bool vsync)
+{
+    Uint64 now, last_flip, refresh, pipeline, ready, vblank, wake;
+    struct timespec ts;
+
+    if (!timing->pacing) {
+        return;
+    }
+
+    now = KMSDRM_TimingNow();
+
+    SDL_AtomicLock(&timing->lock);
+    last_flip = timing->last_flip_ns;
+    refresh = timing->refresh_ns;
+    pipeline = timing->pipeline_ns;
+    SDL_AtomicUnlock(&timing->lock);
+
+    if (vsync && last_flip && refresh) {
+        ready = SDL_max(now, swap_ns + pipeline);
+        vblank = last_flip + refresh;
+        if (ready > vblank) {
+            vblank += ((ready - vblank) / refresh + 1) * refresh;
+        }
+
+        wake = vblank + refresh;
+        if (wake > pipeline + timing->app_cost_ns + KMSDRM_PACING_MARGIN_NS) {
+            wake -= pipeline + timing->app_cost_ns + KMSDRM_PACING_MARGIN_NS;
+        } else {
+            wake = 0;
+        }
+
+        /* Never hold the app for longer than a refresh, predictions can be off */
+        if (wake > now) {
+            wake = SDL_min(wake, now + refresh);
+            ts.tv_sec = (time_t)(wake / KMSDRM_NS_PER_SECOND);
+            ts.tv_nsec = (long)(wake % KMSDRM_NS_PER_SECOND);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+            }
+        }
+    }
+
+    timing->last_return_ns = KMSDRM_TimingNow();
+}
+
+#ifdef __LINUX__
+int
+KMSDRM_GetFrameTimings(_THIS, SDL_Window *window, SDL_KMSDRMFrameTiming *timings, int count)
+{
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    KMSDRM_FrameTimes *timing = &windata->timing;
+    int first, i, n;
+
+    SDL_AtomicLock(&timing->lock);
+
+    n = timing->count;
+    if (timings) {
+        n = SDL_min(n, count);
+        first = timing->head - n + KMSDRM_TIMING_FRAMES;
+        for (i = 0; i < n; i++) {
+            timings[i] = timing->frames[(first + i) % KMSDRM_TIMING_FRAMES];
+        }
+    }
+
+    SDL_AtomicUnlock(&timing->lock);
+
+    return n;
+}
+#endif /* __LINUX__ */
+
+#endif /* SDL_VIDEO_DRIVER_KMSDRM */
+
+/* vi: set ts=4 sw=4 expandtab: */
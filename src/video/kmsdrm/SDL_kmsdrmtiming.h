@@ -0,0 +1,83 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifndef SDL_kmsdrmtiming_h_
+#define SDL_kmsdrmtiming_h_
+
+#include "SDL_atomic.h"
+#include "SDL_system.h"
+
+#include <xf86drmMode.h>
+
+/* Frames kept in the ring buffer for SDL_KMSDRMGetFrameTimings() */
+#define KMSDRM_TIMING_FRAMES 128
+
+/* Per-window presentation timing. A frame's timestamps are filled in as it
+   goes through the swap path (swap -> fence -> submit), and the whole
+   record lands in the ring buffer when its page flip event arrives.
+   Frames are written from whichever thread presents (the app's or the
+   blitter's) and read from the app's, hence the lock. */
+typedef struct KMSDRM_FrameTimes
+{
+    SDL_SpinLock lock;
+    SDL_KMSDRMFrameTiming frames[KMSDRM_TIMING_FRAMES];
+    int head;                           /* Next slot to write */
+    int count;
+
+    SDL_KMSDRMFrameTiming next;         /* Frame on its way to KMS */
+    SDL_KMSDRMFrameTiming inflight;     /* Frame committed, waiting for its flip */
+
+    Uint64 refresh_ns;                  /* Refresh period of the current mode */
+    Uint64 last_flip_ns;
+
+    /* Just in time frame pacing, see KMSDRM_TimingPace() */
+    SDL_bool pacing;
+    Uint64 app_cost_ns;                 /* Decaying peak of the app's frame time */
+    Uint64 pipeline_ns;                 /* Decaying peak of swap to submit time */
+    Uint64 last_return_ns;              /* When SwapWindow last returned */
+
+    /* Running totals for the debug log summaries */
+    Uint64 summary_start_ns;
+    Uint64 summary_latency_ns;
+    Uint64 summary_max_latency_ns;
+    Uint32 summary_frames;
+    Uint32 summary_missed;
+} KMSDRM_FrameTimes;
+
+extern Uint64 KMSDRM_TimingNow(void);
+extern void KMSDRM_TimingSetMode(KMSDRM_FrameTimes *timing, const drmModeModeInfo *mode);
+
+/* Swap path hooks, in the order a frame goes through them */
+extern void KMSDRM_TimingSwap(KMSDRM_FrameTimes *timing, Uint64 swap_ns);
+extern void KMSDRM_TimingFence(KMSDRM_FrameTimes *timing, Uint64 fence_ns);
+extern void KMSDRM_TimingSubmit(KMSDRM_FrameTimes *timing);
+extern void KMSDRM_TimingFlip(KMSDRM_FrameTimes *timing, unsigned int sequence,
+                              unsigned int sec, unsigned int usec);
+
+/* Frame pacing, called when SwapWindow is entered and about to return */
+extern void KMSDRM_TimingPaceSwap(KMSDRM_FrameTimes *timing, Uint64 swap_ns);
+extern void KMSDRM_TimingPace(KMSDRM_FrameTimes *timing, Uint64 swap_ns, SDL_bool vsync);
+
+#endif /* SDL_kmsdrmtiming_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -46,12 +46,18 @@
 #include "SDL_kmsdrmdyn.h"
 #include "SDL_kmsdrmblitter.h"
 #include "SDL_kmsdrmvulkan.h"
+#include "SDL_kmsdrmatomic.h"
+#include "SDL_kmsdrmframebuffer.h"
 #include <sys/stat.h>
 #include <sys/param.h>
 #include <sys/utsname.h>
 #include <dirent.h>
 #include <poll.h>
+#ifdef SDL_INPUT_LINUXEV
+#include <sys/eventfd.h>
+#endif
 #include <errno.h>
+#include <drm_fourcc.h>
 
 #ifdef __OpenBSD__
 static SDL_bool moderndri = SDL_FALSE;
@@ -69,16 +75,94 @@ static char kmsdrm_dri_cardpath[32];
 #define EGL_PLATFORM_GBM_MESA 0x31D7
 #endif
 
+/* What get_driindex() found on the device it picked, kept for
+   KMSDRM_InitDisplays() so it doesn't have to open and probe it again:
+   getting a connector makes the kernel probe it, which is slow. Holds a
+   reference on the libdrm/GBM symbols while there's something in it. */
+static struct {
+    int devindex;
+    int drm_fd;
+    drmModeRes *resources;
+    drmModeConnector **connectors;  /* Same order as resources->connectors */
+} kmsdrm_probe = { -1, -1, NULL, NULL };
+
+static void
+KMSDRM_FreeConnectors(drmModeRes *resources, drmModeConnector **connectors)
+{
+    int i;
+
+    for (i = 0; i < resources->count_connectors; i++) {
+        if (connectors[i]) {
+            KMSDRM_drmModeFreeConnector(connectors[i]);
+        }
+    }
+    SDL_free(connectors);
+}
+
+static void
+KMSDRM_FreeProbe(void)
+{
+    if (kmsdrm_probe.drm_fd < 0) {
+        return;
+    }
+
+    if (kmsdrm_probe.connectors) {
+        KMSDRM_FreeConnectors(kmsdrm_probe.resources, kmsdrm_probe.connectors);
+    }
+    if (kmsdrm_probe.resources) {
+        KMSDRM_drmModeFreeResources(kmsdrm_probe.resources);
+    }
+    close(kmsdrm_probe.drm_fd);
+
+    kmsdrm_probe.drm_fd = -1;
+    kmsdrm_probe.resources = NULL;
+    kmsdrm_probe.connectors = NULL;
+
+    SDL_KMSDRM_UnloadSymbols();
+}
+
+/* Is there a connected connector with modes we can get at? Fills in the
+   probe's connectors as it goes. */
+static SDL_bool
+KMSDRM_ProbeConnectors(int drm_fd, drmModeRes *resources, drmModeConnector **connectors)
+{
+    SDL_bool found = SDL_FALSE;
+    int i;
+
+    for (i = 0; i < resources->count_connectors; i++) {
+        drmModeConnector *conn = KMSDRM_drmModeGetConnector(drm_fd, resources->connectors[i]);
+
+        connectors[i] = conn;
+        if (!conn || conn->connection != DRM_MODE_CONNECTED || !conn->count_modes) {
+            continue;
+        }
+
+        if (SDL_GetHintBoolean(SDL_HINT_KMSDRM_REQUIRE_DRM_MASTER, SDL_TRUE)) {
+            /* Skip this device if we can't obtain DRM master */
+            KMSDRM_drmSetMaster(drm_fd);
+            if (KMSDRM_drmAuthMagic(drm_fd, 0) == -EACCES) {
+                continue;
+            }
+        }
+
+        found = SDL_TRUE;
+    }
+
+    return found;
+}
+
+/* Find the first card with a connected display. Cards are only opened and
+   probed once, the one picked stays open for KMSDRM_InitDisplays(). */
 static int
 get_driindex(void)
 {
     int available = -ENOENT;
     char device[sizeof(kmsdrm_dri_cardpath)];
     int drm_fd;
-    int i;
     int devindex = -1;
     DIR *folder;
     const char *hint;
+    struct dirent *res;
 
     hint = SDL_GetHint(SDL_HINT_KMSDRM_DEVICE_INDEX);
     if (hint && *hint) {
@@ -89,6 +173,11 @@ get_driindex(void)
         }
     }
 
+    /* A previous SDL_VideoInit() may have found one already */
+    if (kmsdrm_probe.drm_fd >= 0) {
+        return kmsdrm_probe.devindex;
+    }
+
     SDL_strlcpy(device, kmsdrm_dri_path, sizeof(device));
     folder = opendir(device);
     if (!folder) {
@@ -96,82 +185,82 @@ get_driindex(void)
         return -ENOENT;
     }
 
+    if (!SDL_KMSDRM_LoadSymbols()) {
+        closedir(folder);
+        return -ENOENT;
+    }
+
     SDL_strlcpy(device + kmsdrm_dri_pathsize, kmsdrm_dri_devname,
                 sizeof(device) - kmsdrm_dri_devnamesize);
-    for (struct dirent *res; (res = readdir(folder));) {
-        if (SDL_memcmp(res->d_name, kmsdrm_dri_devname,
-                       kmsdrm_dri_devnamesize) == 0) {
-            SDL_strlcpy(device + kmsdrm_dri_pathsize + kmsdrm_dri_devnamesize,
-                        res->d_name + kmsdrm_dri_devnamesize,
-                        sizeof(device) - kmsdrm_dri_pathsize -
-                            kmsdrm_dri_devnamesize);
-
-            drm_fd = open(device, O_RDWR | O_CLOEXEC);
-            if (drm_fd >= 0) {
-                devindex = SDL_atoi(device + kmsdrm_dri_pathsize +
-                                    kmsdrm_dri_devnamesize);
-                if (SDL_KMSDRM_LoadSymbols()) {
-                    drmModeRes *resources = KMSDRM_drmModeGetResources(drm_fd);
-                    if (resources) {
-                        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
-                                     "%s%d connector, encoder and CRTC counts are: %d %d %d",
-                                     kmsdrm_dri_cardpath, devindex,
-                                     resources->count_connectors,
-                                     resources->count_encoders,
-                                     resources->count_crtcs);
-
-                        if (resources->count_connectors > 0 &&
-                            resources->count_encoders > 0 &&
-                            resources->count_crtcs > 0) {
-                            available = -ENOENT;
-                            for (i = 0; i < resources->count_connectors; i++) {
-                                drmModeConnector *conn =
-                                    KMSDRM_drmModeGetConnector(
-                                        drm_fd, resources->connectors[i]);
-
-                                if (!conn) {
-                                    continue;
-                                }
-
-                                if (conn->connection == DRM_MODE_CONNECTED &&
-                                    conn->count_modes) {
-                                    if (SDL_GetHintBoolean(
-                                            SDL_HINT_KMSDRM_REQUIRE_DRM_MASTER,
-                                            SDL_TRUE)) {
-                                        /* Skip this device if we can't obtain
-                                         * DRM master */
-                                        KMSDRM_drmSetMaster(drm_fd);
-                                        if (KMSDRM_drmAuthMagic(drm_fd, 0) ==
-                                            -EACCES) {
-                                            continue;
-                                        }
-                                    }
-
-                                    available = devindex;
-                                    break;
-                                }
-
-                                KMSDRM_drmModeFreeConnector(conn);
-                            }
-                        }
-                        KMSDRM_drmModeFreeResources(resources);
-                    }
-                    SDL_KMSDRM_UnloadSymbols();
-                }
-                close(drm_fd);
-            }
+    while (available < 0 && (res = readdir(folder))) {
+        drmModeRes *resources;
+        drmModeConnector **connectors;
+
+        if (SDL_memcmp(res->d_name, kmsdrm_dri_devname, kmsdrm_dri_devnamesize) != 0) {
+            continue;
+        }
 
+        SDL_strlcpy(device + kmsdrm_dri_pathsize + kmsdrm_dri_devnamesize,
+                    res->d_name + kmsdrm_dri_devnamesize,
+                    sizeof(device) - kmsdrm_dri_pathsize -
+                        kmsdrm_dri_devnamesize);
+
+        drm_fd = open(device, O_RDWR | O_CLOEXEC);
+        if (drm_fd < 0) {
             SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
                          "Failed to open KMSDRM device %s, errno: %d\n", device,
                          errno);
+            continue;
+        }
+
+        devindex = SDL_atoi(device + kmsdrm_dri_pathsize + kmsdrm_dri_devnamesize);
+        resources = KMSDRM_drmModeGetResources(drm_fd);
+        if (!resources) {
+            close(drm_fd);
+            continue;
+        }
+
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO,
+                     "%s%d connector, encoder and CRTC counts are: %d %d %d",
+                     kmsdrm_dri_cardpath, devindex,
+                     resources->count_connectors,
+                     resources->count_encoders,
+                     resources->count_crtcs);
+
+        connectors = NULL;
+        if (resources->count_connectors > 0 &&
+            resources->count_encoders > 0 &&
+            resources->count_crtcs > 0) {
+            connectors = (drmModeConnector **)SDL_calloc(resources->count_connectors,
+                                                         sizeof(*connectors));
+        }
+
+        if (connectors && KMSDRM_ProbeConnectors(drm_fd, resources, connectors)) {
+            kmsdrm_probe.devindex = devindex;
+            kmsdrm_probe.drm_fd = drm_fd;
+            kmsdrm_probe.resources = resources;
+            kmsdrm_probe.connectors = connectors;
+            available = devindex;
+        } else {
+            if (connectors) {
+                KMSDRM_FreeConnectors(resources, connectors);
+            }
+            KMSDRM_drmModeFreeResources(resources);
+            close(drm_fd);
         }
     }
 
     closedir(folder);
 
+    /* The probe keeps the symbols loaded */
+    if (available < 0) {
+        SDL_KMSDRM_UnloadSymbols();
+    }
+
     return available;
 }
 
+/* Returns the index of the device to use, < 0 if there's none */
 static int
 KMSDRM_Available(void)
 {
@@ -204,23 +293,28 @@ KMSDRM_Available(void)
                  kmsdrm_dri_path, kmsdrm_dri_devname);
 
     ret = get_driindex();
-    if (ret >= 0) {
-        return 1;
-    }
-
     return ret;
 }
 
 static void
 KMSDRM_DeleteDevice(SDL_VideoDevice * device)
 {
+    if (device->wakeup_lock) {
+        SDL_DestroyMutex(device->wakeup_lock);
+    }
+
     if (device->driverdata) {
+        SDL_VideoData *viddata = (SDL_VideoData *)device->driverdata;
+        if (viddata->wakeup_fd >= 0) {
+            close(viddata->wakeup_fd);
+        }
         SDL_free(device->driverdata);
         device->driverdata = NULL;
     }
 
     SDL_free(device);
 
+    KMSDRM_FreeProbe();
     SDL_KMSDRM_UnloadSymbols();
 }
 
@@ -231,23 +325,22 @@ KMSDRM_CreateDevice(void)
     SDL_VideoData *viddata;
     int devindex;
 
-    if (!KMSDRM_Available()) {
-        return NULL;
-    }
-
-    devindex = get_driindex();
+    devindex = KMSDRM_Available();
     if (devindex < 0) {
         SDL_SetError("devindex (%d) must be between 0 and 99.", devindex);
         return NULL;
     }
 
     if (!SDL_KMSDRM_LoadSymbols()) {
+        KMSDRM_FreeProbe();
         return NULL;
     }
 
     device = (SDL_VideoDevice *) SDL_calloc(1, sizeof(SDL_VideoDevice));
     if (!device) {
         SDL_OutOfMemory();
+        KMSDRM_FreeProbe();
+        SDL_KMSDRM_UnloadSymbols();
         return NULL;
     }
 
@@ -258,6 +351,8 @@ KMSDRM_CreateDevice(void)
     }
     viddata->devindex = devindex;
     viddata->drm_fd = -1;
+    viddata->idle_drm_fd = -1;
+    viddata->wakeup_fd = -1;
 
     device->driverdata = viddata;
 
@@ -275,6 +370,18 @@ KMSDRM_CreateDevice(void)
     device->SetWindowFullscreen = KMSDRM_SetWindowFullscreen;
     device->GetWindowGammaRamp = KMSDRM_GetWindowGammaRamp;
     device->SetWindowGammaRamp = KMSDRM_SetWindowGammaRamp;
+    device->CreateWindowFramebuffer = KMSDRM_CreateWindowFramebuffer;
+    device->UpdateWindowFramebuffer = KMSDRM_UpdateWindowFramebuffer;
+    device->DestroyWindowFramebuffer = KMSDRM_DestroyWindowFramebuffer;
+#ifdef __LINUX__
+    device->KMSDRM_GetFrameTimings = KMSDRM_GetFrameTimings;
+    device->KMSDRM_SetSwapDamage = KMSDRM_SetSwapDamage;
+    device->KMSDRM_GetColorPipeline = KMSDRM_GetColorPipeline;
+    device->KMSDRM_SetColorPipeline = KMSDRM_SetColorPipeline;
+    device->KMSDRM_SetCaptureFrames = KMSDRM_SetCaptureFrames;
+    device->KMSDRM_AcquireCaptureFrame = KMSDRM_AcquireCaptureFrame;
+    device->KMSDRM_ReleaseCaptureFrame = KMSDRM_ReleaseCaptureFrame;
+#endif
     device->ShowWindow = KMSDRM_ShowWindow;
     device->HideWindow = KMSDRM_HideWindow;
     device->RaiseWindow = KMSDRM_RaiseWindow;
@@ -304,6 +411,15 @@ KMSDRM_CreateDevice(void)
 #endif
 
     device->PumpEvents = KMSDRM_PumpEvents;
+#ifdef SDL_INPUT_LINUXEV
+    /* SDL_WaitEvent() sleeps in poll() on the input and DRM FDs */
+    viddata->wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (viddata->wakeup_fd >= 0) {
+        device->wakeup_lock = SDL_CreateMutex();
+        device->WaitEventTimeout = KMSDRM_WaitEventTimeout;
+        device->SendWakeupEvent = KMSDRM_SendWakeupEvent;
+    }
+#endif
     device->free = KMSDRM_DeleteDevice;
 
     return device;
@@ -313,6 +429,8 @@ cleanup:
         SDL_free(device);
     if (viddata)
         SDL_free(viddata);
+    KMSDRM_FreeProbe();
+    SDL_KMSDRM_UnloadSymbols();
     return NULL;
 }
 
@@ -332,26 +450,25 @@ KMSDRM_FBDestroyCallback(struct gbm_bo *bo, void *data)
         SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Delete DRM FB %u", fb_info->fb_id);
     }
 
+    /* The blitter outlived the BO: have it drop its import. */
+    if (fb_info && fb_info->blitter) {
+        KMSDRM_BlitterForgetImport(fb_info->blitter, fb_info);
+    }
+
     SDL_free(fb_info);
 }
 
+/* Get the data attached to a BO, attaching an empty one if there's none yet. */
 KMSDRM_FBInfo *
-KMSDRM_FBFromBO(_THIS, struct gbm_bo *bo)
+KMSDRM_GetBOInfo(_THIS, struct gbm_bo *bo)
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
-    unsigned w,h;
-    int ret;
-    Uint32 stride, handle;
-
-    /* Check for an existing framebuffer */
     KMSDRM_FBInfo *fb_info = (KMSDRM_FBInfo *)KMSDRM_gbm_bo_get_user_data(bo);
 
     if (fb_info) {
         return fb_info;
     }
 
-    /* Create a structure that contains enough info to remove the framebuffer
-       when the backing buffer is destroyed */
     fb_info = (KMSDRM_FBInfo *)SDL_calloc(1, sizeof(KMSDRM_FBInfo));
 
     if (!fb_info) {
@@ -361,43 +478,285 @@ KMSDRM_FBFromBO(_THIS, struct gbm_bo *bo)
 
     fb_info->drm_fd = viddata->drm_fd;
 
+    KMSDRM_gbm_bo_set_user_data(bo, fb_info, KMSDRM_FBDestroyCallback);
+
+    return fb_info;
+}
+
+KMSDRM_FBInfo *
+KMSDRM_FBFromBO(_THIS, struct gbm_bo *bo)
+{
+    uint32_t format = KMSDRM_gbm_bo_get_format(bo);
+
+    /* 32-bit BOs get the legacy FB, the display ignores alpha anyway.
+       Anything else needs its fourcc. GBM and DRM fourccs are the same. */
+    if (format == GBM_FORMAT_ARGB8888 || format == GBM_FORMAT_XRGB8888) {
+        format = 0;
+    }
+
+    return KMSDRM_FBFromBOFormat(_this, bo, format);
+}
+
+/* Was the BO allocated with an explicit modifier? Only then do FBs need
+   one, the legacy calls take the driver's implicit layout. */
+static SDL_bool
+KMSDRM_BOHasModifier(SDL_VideoData *viddata, struct gbm_bo *bo)
+{
+    uint64_t modifier;
+
+    if (!KMSDRM_drmModeAddFB2WithModifiers || !KMSDRM_gbm_bo_get_modifier) {
+        return SDL_FALSE;
+    }
+
+    modifier = KMSDRM_gbm_bo_get_modifier(bo);
+    return modifier != DRM_FORMAT_MOD_INVALID && modifier != DRM_FORMAT_MOD_LINEAR;
+}
+
+/* Create a scanout capable GBM surface, tiled or compressed if the display's
+   primary plane takes any such modifier, implicit otherwise. The modifiers
+   are the ones listed for XRGB8888, so other formats don't get them. */
+struct gbm_surface *
+KMSDRM_CreateGBMSurface(_THIS, SDL_DisplayData *dispdata, uint32_t width, uint32_t height,
+                        uint32_t format, uint32_t flags)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    struct gbm_surface *gs;
+
+    if (dispdata->num_modifiers > 0 && format == GBM_FORMAT_XRGB8888) {
+        gs = KMSDRM_gbm_surface_create_with_modifiers(viddata->gbm_dev, width, height, format,
+                                                      dispdata->modifiers, dispdata->num_modifiers);
+        if (gs) {
+            return gs;
+        }
+
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Could not create GBM surface with modifiers, trying without");
+    }
+
+    return KMSDRM_gbm_surface_create(viddata->gbm_dev, width, height, format, flags);
+}
+
+/* Add a rect, clipped to the frame, to a frame's damage. */
+void
+KMSDRM_AddDamage(KMSDRM_Damage *damage, const SDL_Rect *rect, int width, int height)
+{
+    const SDL_Rect bounds = { 0, 0, width, height };
+    SDL_Rect clipped;
+
+    if (!damage->partial || !SDL_IntersectRect(rect, &bounds, &clipped)) {
+        return;
+    }
+
+    if (damage->num_rects < KMSDRM_MAX_DAMAGE_RECTS) {
+        damage->rects[damage->num_rects++] = clipped;
+    } else {
+        SDL_UnionRect(&damage->rects[KMSDRM_MAX_DAMAGE_RECTS - 1], &clipped,
+                      &damage->rects[KMSDRM_MAX_DAMAGE_RECTS - 1]);
+    }
+}
+
+/* Damage of two frames presented as one, when the first never made it to
+   the screen. Rects are already clipped, so no bounds are needed. */
+void
+KMSDRM_MergeDamage(KMSDRM_Damage *damage, const KMSDRM_Damage *other)
+{
+    int i;
+
+    if (!other->partial) {
+        damage->partial = SDL_FALSE;
+    }
+
+    for (i = 0; i < other->num_rects; i++) {
+        KMSDRM_AddDamage(damage, &other->rects[i], SDL_MAX_SINT32, SDL_MAX_SINT32);
+    }
+}
+
+/* Same as KMSDRM_FBFromBO(), but with an explicit DRM fourcc for the FB.
+   A format of 0 means the legacy depth 24, 32bpp FB, which is what every
+   driver accepts on the primary plane. */
+KMSDRM_FBInfo *
+KMSDRM_FBFromBOFormat(_THIS, struct gbm_bo *bo, uint32_t format)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    unsigned w,h;
+    int ret;
+    Uint32 stride, handle;
+
+    /* Check for an existing framebuffer */
+    KMSDRM_FBInfo *fb_info = KMSDRM_GetBOInfo(_this, bo);
+
+    if (!fb_info || fb_info->fb_id) {
+        return fb_info;
+    }
+
     /* Create framebuffer object for the buffer */
     w = KMSDRM_gbm_bo_get_width(bo);
     h = KMSDRM_gbm_bo_get_height(bo);
     stride = KMSDRM_gbm_bo_get_stride(bo);
     handle = KMSDRM_gbm_bo_get_handle(bo).u32;
-    ret = KMSDRM_drmModeAddFB(viddata->drm_fd, w, h, 24, 32, stride, handle,
+    if (KMSDRM_BOHasModifier(viddata, bo)) {
+        /* Tiled or compressed buffers may have more planes (e.g. CCS
+           metadata), and need their modifier passed along. */
+        uint32_t handles[4] = { 0 }, pitches[4] = { 0 }, offsets[4] = { 0 };
+        uint64_t modifiers[4] = { 0 };
+        uint64_t modifier = KMSDRM_gbm_bo_get_modifier(bo);
+        int plane, num_planes = SDL_min(KMSDRM_gbm_bo_get_plane_count(bo), 4);
+
+        for (plane = 0; plane < num_planes; plane++) {
+            handles[plane] = KMSDRM_gbm_bo_get_handle_for_plane(bo, plane).u32;
+            pitches[plane] = KMSDRM_gbm_bo_get_stride_for_plane(bo, plane);
+            offsets[plane] = KMSDRM_gbm_bo_get_offset(bo, plane);
+            modifiers[plane] = modifier;
+        }
+
+        ret = KMSDRM_drmModeAddFB2WithModifiers(viddata->drm_fd, w, h,
+                                                format ? format : DRM_FORMAT_XRGB8888,
+                                                handles, pitches, offsets, modifiers,
+                                                &fb_info->fb_id, DRM_MODE_FB_MODIFIERS);
+    } else if (format) {
+        const uint32_t handles[4] = { handle };
+        const uint32_t pitches[4] = { stride };
+        const uint32_t offsets[4] = { 0 };
+        ret = KMSDRM_drmModeAddFB2(viddata->drm_fd, w, h, format, handles, pitches, offsets,
+                                   &fb_info->fb_id, 0);
+    } else {
+        ret = KMSDRM_drmModeAddFB(viddata->drm_fd, w, h, 24, 32, stride, handle,
                                   &fb_info->fb_id);
+    }
     if (ret) {
-      SDL_free(fb_info);
+      fb_info->fb_id = 0;
       return NULL;
     }
 
     SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "New DRM FB (%u): %ux%u, stride %u from BO %p",
                  fb_info->fb_id, w, h, stride, (void *)bo);
 
-    /* Associate our DRM framebuffer with this buffer object */
-    KMSDRM_gbm_bo_set_user_data(bo, fb_info, KMSDRM_FBDestroyCallback);
-
     return fb_info;
 }
 
+/* Page flips (legacy and atomic) are all requested with the windata as user data.
+   Runs with drm_event_lock held, from whichever thread read the event.
+   Commits with clones get an event per CRTC: the frame is only done flipping
+   with the last one, and the clones' don't count for timing. */
 static void
-KMSDRM_FlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+KMSDRM_FlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec,
+                   unsigned int crtc_id, void *data)
 {
-    *((SDL_bool *) data) = SDL_FALSE;
+    SDL_WindowData *windata = (SDL_WindowData *)data;
+    Uint64 flip_ns = (Uint64)sec * 1000000000 + (Uint64)usec * 1000;
+    KMSDRM_FlipEvent *event;
+    int i;
+
+    if (windata->flips_pending > 1) {
+        windata->flips_pending--;
+    } else {
+        windata->flips_pending = 0;
+        windata->waiting_for_flip = SDL_FALSE;
+    }
+
+    for (i = 0; i < windata->num_clones; i++) {
+        if (windata->clones[i]->crtc->crtc_id == crtc_id) {
+            return;
+        }
+    }
+    KMSDRM_TimingFlip(&windata->timing, frame, sec, usec);
+    KMSDRM_CaptureFlip(&windata->capture, frame, flip_ns);
+
+    /* Only recorded here: the app's event filters can't run on this thread
+       or under the lock. KMSDRM_SendFlipEvents() sends them, and drops the
+       oldest if the app doesn't pump its events for a while. */
+    if (SDL_GetEventState(SDL_SYSWMEVENT) == SDL_ENABLE) {
+        if (windata->num_flip_events == KMSDRM_MAX_FLIP_EVENTS) {
+            SDL_memmove(&windata->flip_events[0], &windata->flip_events[1],
+                        (KMSDRM_MAX_FLIP_EVENTS - 1) * sizeof(windata->flip_events[0]));
+            windata->num_flip_events--;
+        }
+        event = &windata->flip_events[windata->num_flip_events++];
+        event->sequence = frame;
+        event->flip_ns = flip_ns;
+    }
+}
+
+static void
+KMSDRM_HandleDRMEvent(SDL_VideoData *viddata)
+{
+    drmEventContext ev = {0};
+
+    ev.version = DRM_EVENT_CONTEXT_VERSION;
+    ev.page_flip_handler2 = KMSDRM_FlipHandler;
+
+    KMSDRM_drmHandleEvent(viddata->drm_fd, &ev);
+}
+
+/* Dispatch the DRM events that are already there, without blocking. Does
+   nothing if a thread is blocked on the FD: it will dispatch them itself. */
+void
+KMSDRM_DispatchDRMEvents(_THIS)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    struct pollfd pfd = {0};
+
+    if (viddata->drm_fd < 0 || !viddata->drm_event_lock) {
+        return;
+    }
+
+    SDL_LockMutex(viddata->drm_event_lock);
+    if (!viddata->drm_event_reader) {
+        pfd.fd = viddata->drm_fd;
+        pfd.events = POLLIN;
+        while (poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
+            KMSDRM_HandleDRMEvent(viddata);
+        }
+        SDL_CondBroadcast(viddata->drm_event_cond);
+    }
+    SDL_UnlockMutex(viddata->drm_event_lock);
+}
+
+/* Send the page flips the flip handler recorded as SDL_SYSWMEVENT, from the
+   thread pumping events and without drm_event_lock held */
+void
+KMSDRM_SendFlipEvents(_THIS)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    KMSDRM_FlipEvent events[KMSDRM_MAX_FLIP_EVENTS];
+    SDL_SysWMmsg wmmsg;
+    SDL_Window *window;
+    int i, num_events;
+
+    if (!viddata->drm_event_lock) {
+        return;
+    }
+
+    for (window = _this->windows; window; window = window->next) {
+        SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+
+        if (!windata) {
+            continue;
+        }
+
+        SDL_LockMutex(viddata->drm_event_lock);
+        num_events = windata->num_flip_events;
+        SDL_memcpy(events, windata->flip_events, num_events * sizeof(events[0]));
+        windata->num_flip_events = 0;
+        SDL_UnlockMutex(viddata->drm_event_lock);
+
+        for (i = 0; i < num_events; i++) {
+            SDL_VERSION(&wmmsg.version);
+            wmmsg.subsystem = SDL_SYSWM_KMSDRM;
+            wmmsg.msg.kmsdrm.windowID = window->id;
+            wmmsg.msg.kmsdrm.sequence = events[i].sequence;
+            wmmsg.msg.kmsdrm.flip_ns = events[i].flip_ns;
+            SDL_SendSysWMEvent(&wmmsg);
+        }
+    }
 }
 
 SDL_bool
 KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata) {
 
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
-    drmEventContext ev = {0};
     struct pollfd pfd = {0};
-    int ret;
-
-    ev.version = DRM_EVENT_CONTEXT_VERSION;
-    ev.page_flip_handler = KMSDRM_FlipHandler;
+    SDL_bool ret = SDL_TRUE;
+    int err;
 
     pfd.fd = viddata->drm_fd;
     pfd.events = POLLIN;
@@ -418,18 +777,34 @@ KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata) {
       we are waiting for, so the drmEventHandle() doesn't run the flip handler, and
       since waiting_for_flip is set on the pageflip handle, it's not set and we stay
       on the loop, until we get the event for the pageflip, which is fine.
+
+      The event pump and the blitter thread read the same FD, and an event is only
+      read once. Only one thread polls at a time, so nobody sleeps on an event some
+      other thread already took: the rest wait for the reader to dispatch theirs.
     */
+    SDL_LockMutex(viddata->drm_event_lock);
     while (windata->waiting_for_flip) {
 
+        if (viddata->drm_event_reader) {
+            SDL_CondWait(viddata->drm_event_cond, viddata->drm_event_lock);
+            continue;
+        }
+        viddata->drm_event_reader = SDL_TRUE;
+        SDL_UnlockMutex(viddata->drm_event_lock);
+
         pfd.revents = 0;
 
         /* poll() waits for events arriving on the FD, and returns < 0 if timeout passes
            with no events or a signal occurred before any requested event (-EINTR).
            We wait forever (timeout = -1), but even if we DO get an event, we have yet
            to see if it's of the required type, then if it's a pageflip, etc */
-        ret = poll(&pfd, 1, -1);
+        err = poll(&pfd, 1, -1);
+
+        SDL_LockMutex(viddata->drm_event_lock);
+        viddata->drm_event_reader = SDL_FALSE;
+        SDL_CondBroadcast(viddata->drm_event_cond);
 
-        if (ret < 0) {
+        if (err < 0) {
             if (errno == EINTR) {
                 /* poll() returning < 0 and setting errno = EINTR means there was a signal before
                    any requested event, so we immediately poll again. */
@@ -437,14 +812,16 @@ KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata) {
             } else {
                 /* There was another error. Don't pull again or we could get into a busy loop. */
                 SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "DRM poll error");
-                return SDL_FALSE; /* Return number 1. */
+                ret = SDL_FALSE; /* Return number 1. */
+                break;
             }
         }
 
         if (pfd.revents & (POLLHUP | POLLERR)) {
             /* An event arrived on the FD in time, but it's an error. */
             SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "DRM poll hup or error");
-            return SDL_FALSE; /* Return number 2. */
+            ret = SDL_FALSE; /* Return number 2. */
+            break;
         }
 
         if (pfd.revents & POLLIN) {
@@ -453,7 +830,7 @@ KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata) {
                event we are passing in &ev. If it does, drmHandleEvent() will unset
                windata->waiting_for_flip and we will get out of the "while" loop.
                If it's not, we keep iterating on the loop. */
-            KMSDRM_drmHandleEvent(viddata->drm_fd, &ev);
+            KMSDRM_HandleDRMEvent(viddata);
         }
             
         /* If we got to this point in the loop, we may iterate or exit the loop:
@@ -468,28 +845,74 @@ KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata) {
             to polling. */ 
 
     }
+    SDL_UnlockMutex(viddata->drm_event_lock);
 
-    return SDL_TRUE;
+    return ret;
+}
+
+/* The exact refresh rate of a mode, in Hz. The vrefresh field is rounded to
+   an integer, which is no good for pacing 59.73 Hz content. */
+static double
+KMSDRM_GetModeRefreshRate(const drmModeModeInfo *mode)
+{
+    double rate;
+
+    if (!mode->clock || !mode->htotal || !mode->vtotal) {
+        return mode->vrefresh;
+    }
+
+    rate = mode->clock * 1000.0 / ((double)mode->htotal * mode->vtotal);
+
+    if (mode->flags & DRM_MODE_FLAG_INTERLACE) {
+        rate *= 2.0;
+    }
+    if (mode->flags & DRM_MODE_FLAG_DBLSCAN) {
+        rate /= 2.0;
+    }
+    if (mode->vscan > 1) {
+        rate /= mode->vscan;
+    }
+
+    return rate;
+}
+
+/* How badly a display refresh rate paces content at a given frame rate:
+   the relative drift left after showing each frame for the closest whole
+   number of refreshes. 0 for a perfect match or an exact multiple. */
+static double
+KMSDRM_GetPacingError(double refresh, double content_rate)
+{
+    double repeats = SDL_floor(refresh / content_rate + 0.5);
+
+    if (repeats < 1.0) {
+        repeats = 1.0;
+    }
+
+    return SDL_fabs(refresh / repeats - content_rate) / content_rate;
 }
 
 /* Given w, h and refresh rate, returns the closest DRM video mode
    available on the DRM connector of the display.
    We use the SDL mode list (which we filled in KMSDRM_GetDisplayModes)
-   because it's ordered, while the list on the connector is mostly random.*/
+   because it's ordered, while the list on the connector is mostly random.
+   SDL's mode list only knows integer rates though, so with a content_rate
+   the refresh rate is chosen here, among the modes of the size SDL found. */
 static drmModeModeInfo*
 KMSDRM_GetClosestDisplayMode(SDL_VideoDisplay * display,
-uint32_t width, uint32_t height, uint32_t refresh_rate){
+uint32_t width, uint32_t height, float content_rate){
 
     SDL_DisplayData *dispdata = (SDL_DisplayData *) display->driverdata;
     drmModeConnector *connector = dispdata->connector;
 
     SDL_DisplayMode target, closest;
     drmModeModeInfo *drm_mode;
+    double best_error, error;
+    int i;
 
     target.w = width;
     target.h = height;
     target.format = 0; /* Will use the default mode format. */
-    target.refresh_rate = refresh_rate;
+    target.refresh_rate = 0;
     target.driverdata = 0; /* Initialize to 0 */
 
     if (!SDL_GetClosestDisplayMode(SDL_atoi(display->name), &target, &closest)) {
@@ -497,8 +920,35 @@ uint32_t width, uint32_t height, uint32_t refresh_rate){
     } else {
         SDL_DisplayModeData *modedata = (SDL_DisplayModeData *)closest.driverdata;
         drm_mode = &connector->modes[modedata->mode_index];
+    }
+
+    if (content_rate <= 0.0f) {
         return drm_mode;
     }
+
+    best_error = KMSDRM_GetPacingError(KMSDRM_GetModeRefreshRate(drm_mode), content_rate);
+
+    for (i = 0; i < connector->count_modes; i++) {
+        drmModeModeInfo *mode = &connector->modes[i];
+
+        if (mode->hdisplay != drm_mode->hdisplay || mode->vdisplay != drm_mode->vdisplay ||
+            (mode->flags & DRM_MODE_FLAG_INTERLACE)) {
+            continue;
+        }
+
+        /* Ties go to the mode SDL picked, or the first one found */
+        error = KMSDRM_GetPacingError(KMSDRM_GetModeRefreshRate(mode), content_rate);
+        if (error < best_error - 1e-9) {
+            best_error = error;
+            drm_mode = mode;
+        }
+    }
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Mode %ux%u@%.3f for %.3f Hz content (pacing error %.4f%%)",
+                 drm_mode->hdisplay, drm_mode->vdisplay, KMSDRM_GetModeRefreshRate(drm_mode),
+                 content_rate, best_error * 100.0);
+
+    return drm_mode;
 }
 
 /*****************************************************************************/
@@ -635,6 +1085,14 @@ KMSDRM_AddDisplay (_THIS, drmModeConnector *connector, drmModeRes *resources) {
         goto cleanup;
     }
 
+    /* Planes tell which CRTCs they can be used with by CRTC index. */
+    for (i = 0; i < resources->count_crtcs; i++) {
+        if (resources->crtcs[i] == crtc->crtc_id) {
+            dispdata->crtc_index = i;
+            break;
+        }
+    }
+
     /* Find the index of the mode attached to this CRTC */
     mode_index = -1;
 
@@ -729,7 +1187,8 @@ cleanup:
 /* Initializes the list of SDL displays: we build a new display for each
    connecter connector we find.
    Inoffeensive for VK compatibility, except we must leave the drm_fd
-   closed when we get to the end of this function.
+   closed when we get to the end of this function: it's kept aside, without
+   DRM master, for KMSDRM_GBMInit() to pick up.
    This is to be called early, in VideoInit(), because it gets us
    the videomode information, which SDL needs immediately after VideoInit(). */
 static int
@@ -738,6 +1197,7 @@ KMSDRM_InitDisplays (_THIS) {
     int rotation = 0;
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
     drmModeRes *resources = NULL;
+    drmModeConnector **connectors = NULL;
 
     uint64_t async_pageflip = 0;
     int ret = 0;
@@ -758,28 +1218,47 @@ KMSDRM_InitDisplays (_THIS) {
     SDL_snprintf(viddata->devpath, sizeof(viddata->devpath), "%s%d",
                  kmsdrm_dri_cardpath, viddata->devindex);
 
-    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Opening device %s", viddata->devpath);
-    viddata->drm_fd = open(viddata->devpath, O_RDWR | O_CLOEXEC);
+    if (kmsdrm_probe.drm_fd >= 0 && kmsdrm_probe.devindex == viddata->devindex) {
+        /* Device discovery already got everything, take it over */
+        viddata->drm_fd = kmsdrm_probe.drm_fd;
+        resources = kmsdrm_probe.resources;
+        connectors = kmsdrm_probe.connectors;
+        kmsdrm_probe.drm_fd = -1;
+        kmsdrm_probe.resources = NULL;
+        kmsdrm_probe.connectors = NULL;
+        SDL_KMSDRM_UnloadSymbols();
+    } else {
+        KMSDRM_FreeProbe();
+
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Opening device %s", viddata->devpath);
+        viddata->drm_fd = open(viddata->devpath, O_RDWR | O_CLOEXEC);
 
-    if (viddata->drm_fd < 0) {
-        ret = SDL_SetError("Could not open %s", viddata->devpath);
-        goto cleanup;
-    }
+        if (viddata->drm_fd < 0) {
+            ret = SDL_SetError("Could not open %s", viddata->devpath);
+            goto cleanup;
+        }
 
-    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Opened DRM FD (%d)", viddata->drm_fd);
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Opened DRM FD (%d)", viddata->drm_fd);
 
-    /* Get all of the available connectors / devices / crtcs */
-    resources = KMSDRM_drmModeGetResources(viddata->drm_fd);
-    if (!resources) {
-        ret = SDL_SetError("drmModeGetResources(%d) failed", viddata->drm_fd);
-        goto cleanup;
+        /* Get all of the available connectors / devices / crtcs */
+        resources = KMSDRM_drmModeGetResources(viddata->drm_fd);
+        if (!resources) {
+            ret = SDL_SetError("drmModeGetResources(%d) failed", viddata->drm_fd);
+            goto cleanup;
+        }
     }
 
     /* Iterate on the available connectors. For every connected connector,
        we create an SDL_Display and add it to the list of SDL Displays. */
     for (i = 0; i < resources->count_connectors; i++) {
-        drmModeConnector *connector = KMSDRM_drmModeGetConnector(viddata->drm_fd,
-            resources->connectors[i]);
+        drmModeConnector *connector;
+
+        if (connectors) {
+            connector = connectors[i];
+            connectors[i] = NULL;
+        } else {
+            connector = KMSDRM_drmModeGetConnector(viddata->drm_fd, resources->connectors[i]);
+        }
 
         if (!connector) {
             continue;
@@ -816,11 +1295,15 @@ KMSDRM_InitDisplays (_THIS) {
     /***********************************/
 
     /* THIS IS FOR VULKAN! Leave the FD closed, so VK can work.
-       Will reopen this in CreateWindow, but only if requested a non-VK window. */
-    close (viddata->drm_fd);
+       KMSDRM_GBMInit() reuses it if a non-VK window comes first, and a VK
+       window or library load closes it for good. */
+    KMSDRM_drmDropMaster(viddata->drm_fd);
+    viddata->idle_drm_fd = viddata->drm_fd;
     viddata->drm_fd = -1;
 
 cleanup:
+    if (connectors)
+        KMSDRM_FreeConnectors(resources, connectors);
     if (resources)
         KMSDRM_drmModeFreeResources(resources);
     if (ret) {
@@ -832,6 +1315,18 @@ cleanup:
     return ret;
 }
 
+/* Vulkan opens the device on its own, and doesn't want ours around */
+void
+KMSDRM_CloseIdleFD(_THIS)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+
+    if (viddata->idle_drm_fd >= 0) {
+        close(viddata->idle_drm_fd);
+        viddata->idle_drm_fd = -1;
+    }
+}
+
 /* Init the Vulkan-INCOMPATIBLE stuff:
    Reopen FD, create gbm dev, create dumb buffer and setup display plane.
    This is to be called late, in WindowCreate(), and ONLY if this is not
@@ -845,9 +1340,15 @@ KMSDRM_GBMInit (_THIS, SDL_DisplayData *dispdata)
 {
     SDL_VideoData *viddata = (SDL_VideoData *)_this->driverdata;
     int ret = 0;
+    int i;
 
-    /* Reopen the FD! */
-    viddata->drm_fd = open(viddata->devpath, O_RDWR | O_CLOEXEC);
+    /* Reopen the FD, unless VideoInit() left it to us */
+    if (viddata->idle_drm_fd >= 0) {
+        viddata->drm_fd = viddata->idle_drm_fd;
+        viddata->idle_drm_fd = -1;
+    } else {
+        viddata->drm_fd = open(viddata->devpath, O_RDWR | O_CLOEXEC);
+    }
 
     /* Set the FD we just opened as current DRM master. */
     KMSDRM_drmSetMaster(viddata->drm_fd);
@@ -858,6 +1359,13 @@ KMSDRM_GBMInit (_THIS, SDL_DisplayData *dispdata)
         ret = SDL_SetError("Couldn't create gbm device.");
     }
 
+    /* Atomic needs client caps on this very FD, so it's set up here. */
+    for (i = 0; i < SDL_GetNumVideoDisplays(); i++) {
+        KMSDRM_InitAtomic(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+        KMSDRM_InitVRR(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+        KMSDRM_InitModifiers(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+    }
+
     viddata->gbm_init = SDL_TRUE;
 
     return ret;
@@ -868,6 +1376,16 @@ static void
 KMSDRM_GBMDeinit (_THIS, SDL_DisplayData *dispdata)
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    int i;
+
+    /* Atomic state holds property blobs on this FD, and VRR is switched
+       back off through it. */
+    for (i = 0; i < SDL_GetNumVideoDisplays(); i++) {
+        KMSDRM_DeinitModifiers(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+        KMSDRM_DeinitColor(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+        KMSDRM_DeinitVRR(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+        KMSDRM_DeinitAtomic(_this, (SDL_DisplayData *)SDL_GetDisplayDriverData(i));
+    }
 
     /* Destroy GBM device. GBM surface is destroyed by DestroySurfaces(),
        already called when we get here. */
@@ -885,31 +1403,16 @@ KMSDRM_GBMDeinit (_THIS, SDL_DisplayData *dispdata)
     viddata->gbm_init = SDL_FALSE;
 }
 
+/* Restore the original CRTC configuration: configure the CRTC with the
+   original video mode and make it point to the original TTY buffer.
+   A plane rotation we left behind is undone too, SetCrtc doesn't. */
 static void
-KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
+KMSDRM_RestoreCrtc(_THIS, SDL_DisplayData *dispdata, uint64_t rotation)
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
-    SDL_WindowData *windata = (SDL_WindowData *) window->driverdata;
-    SDL_DisplayData *dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
+    uint32_t rotation_prop;
     int ret;
 
-    /* Destroy blitter first */
-    if (windata->blitter) {
-        KMSDRM_BlitterQuit(windata->blitter);
-        SDL_free(windata->blitter);
-        windata->blitter = NULL;
-    }
-
-    /**********************************************/
-    /* Wait for last issued pageflip to complete. */
-    /**********************************************/
-    /*KMSDRM_WaitPageflip(_this, windata);*/
-
-    /***********************************************************************/
-    /* Restore the original CRTC configuration: configue the crtc with the */
-    /* original video mode and make it point to the original TTY buffer.   */
-    /***********************************************************************/
-
     ret = KMSDRM_drmModeSetCrtc(viddata->drm_fd, dispdata->crtc->crtc_id,
             dispdata->crtc->buffer_id, 0, 0, &dispdata->connector->connector_id, 1,
             &dispdata->original_mode);
@@ -923,8 +1426,44 @@ KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
 
     if(ret) {
         SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Could not restore CRTC");
+    } else {
+        /* Next atomic modeset has to compare against the restored mode. */
+        dispdata->atomic_mode = dispdata->original_mode;
+    }
+
+    /* SetCrtc resets the plane's rectangles, but not its rotation. */
+    rotation_prop = KMSDRM_GetPropertyId(&dispdata->plane_props, "rotation");
+    if (rotation_prop && rotation != DRM_MODE_ROTATE_0) {
+        KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->plane_props.obj_id,
+                                        DRM_MODE_OBJECT_PLANE, rotation_prop, DRM_MODE_ROTATE_0);
+    }
+}
+
+static void
+KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
+{
+    SDL_WindowData *windata = (SDL_WindowData *) window->driverdata;
+    SDL_DisplayData *dispdata = (SDL_DisplayData *) SDL_GetDisplayForWindow(window)->driverdata;
+    uint64_t rotation = windata->plane_scaling ? windata->plane_rotation : DRM_MODE_ROTATE_0;
+    int i;
+
+    /* Park the blitter first, it's kept for the next surfaces. */
+    if (windata->blitter) {
+        KMSDRM_BlitterSuspend(windata->blitter, windata->gs);
     }
 
+    /**********************************************/
+    /* Wait for last issued pageflip to complete. */
+    /**********************************************/
+    /*KMSDRM_WaitPageflip(_this, windata);*/
+
+    KMSDRM_RestoreCrtc(_this, dispdata, rotation);
+    for (i = 0; i < windata->num_clones; i++) {
+        KMSDRM_RestoreCrtc(_this, windata->clones[i], rotation);
+    }
+    windata->num_clones = 0;
+    windata->plane_scaling = SDL_FALSE;
+
     /***************************/
     /* Destroy the EGL surface */
     /***************************/
@@ -940,6 +1479,10 @@ KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
     /* Destroy the GBM buffers */
     /***************************/
 
+    if (windata->gs) {
+        KMSDRM_CaptureForget(&windata->capture, windata->gs);
+    }
+
     if (windata->bo) {
         KMSDRM_gbm_surface_release_buffer(windata->gs, windata->bo);
         windata->bo = NULL;
@@ -960,7 +1503,7 @@ KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
     }
 }
 
-static void
+void
 KMSDRM_GetModeToSet(SDL_Window *window, drmModeModeInfo *out_mode, int rotation) {
     SDL_VideoDisplay *display = SDL_GetDisplayForWindow(window);
     SDL_DisplayData *dispdata = (SDL_DisplayData *)display->driverdata;
@@ -968,12 +1511,13 @@ KMSDRM_GetModeToSet(SDL_Window *window, drmModeModeInfo *out_mode, int rotation)
     if ((window->flags & SDL_WINDOW_FULLSCREEN) == SDL_WINDOW_FULLSCREEN) {
         *out_mode = dispdata->fullscreen_mode;
     } else {
+        SDL_VideoData *viddata = ((SDL_WindowData *)window->driverdata)->viddata;
         drmModeModeInfo *mode;
 
         if ((rotation & 1) == 0) {
-            mode = KMSDRM_GetClosestDisplayMode(display, window->w, window->h, 0);
+            mode = KMSDRM_GetClosestDisplayMode(display, window->w, window->h, viddata->content_rate);
         } else {
-            mode = KMSDRM_GetClosestDisplayMode(display, window->h, window->w, 0);
+            mode = KMSDRM_GetClosestDisplayMode(display, window->h, window->w, viddata->content_rate);
         }
 
         if (mode) {
@@ -1000,6 +1544,62 @@ KMSDRM_DirtySurfaces(SDL_Window *window, int rotation) {
     SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, mode.hdisplay, mode.vdisplay);
 }
 
+/* GBM format for the buffers that get scanned out, the window's own and
+   the blitter's, from SDL_HINT_KMSDRM_SCANOUT_FORMAT. */
+static uint32_t
+KMSDRM_GetScanoutFormat(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_KMSDRM_SCANOUT_FORMAT);
+
+    if (hint && *hint) {
+        if (SDL_strcasecmp(hint, "XRGB8888") == 0) {
+            return GBM_FORMAT_XRGB8888;
+        } else if (SDL_strcasecmp(hint, "RGB565") == 0) {
+            return GBM_FORMAT_RGB565;
+        } else if (SDL_strcasecmp(hint, "ARGB8888") != 0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Unknown scanout format \"%s\", using ARGB8888", hint);
+        }
+    }
+
+    return GBM_FORMAT_ARGB8888;
+}
+
+/* Find the displays a window is mirrored on, see SDL_HINT_KMSDRM_CLONE.
+   Frames are width x height, whatever the window's display scans out. */
+static void
+KMSDRM_SetupClones(_THIS, SDL_Window *window, int width, int height)
+{
+    SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
+    int i;
+
+    windata->num_clones = 0;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_KMSDRM_CLONE, SDL_FALSE)) {
+        return;
+    }
+
+    if (!dispdata->atomic) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Cloning needs atomic modesetting, not cloning");
+        return;
+    }
+
+    for (i = 0; i < SDL_GetNumVideoDisplays() && windata->num_clones < KMSDRM_MAX_CLONES; i++) {
+        SDL_DisplayData *clone = (SDL_DisplayData *)SDL_GetDisplayDriverData(i);
+
+        if (clone == dispdata || clone->crtc->crtc_id == dispdata->crtc->crtc_id ||
+            !clone->mode.hdisplay || !clone->mode.vdisplay) {
+            continue;
+        }
+
+        if (KMSDRM_AtomicTestClone(_this, windata, dispdata, clone, width, height)) {
+            windata->clones[windata->num_clones++] = clone;
+        } else {
+            SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "Display %d can't show the window's frames, not cloning to it", i);
+        }
+    }
+}
+
 /* This determines the size of the fb, which comes from the GBM surface
    that we create here. */
 int
@@ -1010,10 +1610,11 @@ KMSDRM_CreateSurfaces(_THIS, SDL_Window * window)
     SDL_VideoDisplay *display = SDL_GetDisplayForWindow(window);
     SDL_DisplayData *dispdata = (SDL_DisplayData *)display->driverdata;
 
-    uint32_t surface_fmt = GBM_FORMAT_ARGB8888;
+    uint32_t surface_fmt = windata->scanout_format;
     uint32_t surface_flags = GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING;
 
     EGLContext egl_context;
+    const char *hq_scaler;
 
     int ret = 0;
 
@@ -1043,7 +1644,13 @@ KMSDRM_CreateSurfaces(_THIS, SDL_Window * window)
     display->current_mode.refresh_rate = dispdata->mode.vrefresh;
     display->current_mode.format = SDL_PIXELFORMAT_ARGB8888;
 
-    windata->gs = KMSDRM_gbm_surface_create(viddata->gbm_dev,
+    KMSDRM_TimingSetMode(&windata->timing, &dispdata->mode);
+    windata->timing.pacing = SDL_GetHintBoolean(SDL_HINT_KMSDRM_FRAME_PACING, SDL_FALSE);
+
+    /* Nothing of the new surfaces is on screen, the next frame can't be skipped */
+    windata->presented = SDL_FALSE;
+
+    windata->gs = KMSDRM_CreateGBMSurface(_this, dispdata,
                       window->w, window->h,
                       surface_fmt, surface_flags);
 
@@ -1057,6 +1664,23 @@ KMSDRM_CreateSurfaces(_THIS, SDL_Window * window)
     SDL_EGL_SetRequiredVisualId(_this, surface_fmt);
     windata->egl_surface = SDL_EGL_CreateSurface(_this, (NativeWindowType)windata->gs);
 
+    /* The GL config the app asked for may not come in the scanout format
+       it asked for (e.g. 8 bits per channel and RGB565), go back to ARGB8888. */
+    if (windata->egl_surface == EGL_NO_SURFACE && surface_fmt != GBM_FORMAT_ARGB8888) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "No EGL config for the scanout format, using ARGB8888");
+        KMSDRM_gbm_surface_destroy(windata->gs);
+        windata->scanout_format = surface_fmt = GBM_FORMAT_ARGB8888;
+        windata->gs = KMSDRM_CreateGBMSurface(_this, dispdata,
+                          window->w, window->h,
+                          surface_fmt, surface_flags);
+        if (!windata->gs) {
+            return SDL_SetError("Could not create GBM surface");
+        }
+
+        SDL_EGL_SetRequiredVisualId(_this, surface_fmt);
+        windata->egl_surface = SDL_EGL_CreateSurface(_this, (NativeWindowType)windata->gs);
+    }
+
     if (windata->egl_surface == EGL_NO_SURFACE) {
         ret = SDL_SetError("Could not create EGL window surface");
         goto cleanup;
@@ -1067,6 +1691,25 @@ KMSDRM_CreateSurfaces(_THIS, SDL_Window * window)
     egl_context = (EGLContext)SDL_GL_GetCurrentContext();
     ret = SDL_EGL_MakeCurrent(_this, windata->egl_surface, egl_context);
 
+    /* Let the display plane scale and rotate the app's buffers if it can,
+       that saves the blitter's full-screen pass on every frame. The HQ
+       scalers are shaders, so those need the blitter anyway. */
+    hq_scaler = SDL_getenv("SDL_KMSDRM_HQ_SCALER");
+    if ((!hq_scaler || *hq_scaler == '0') &&
+        SDL_GetHintBoolean(SDL_HINT_KMSDRM_PLANE_SCALING, SDL_TRUE) &&
+        KMSDRM_AtomicTestPlaneScaling(_this, windata, dispdata,
+                                      window->w, window->h, viddata->rotation)) {
+        goto done;
+    }
+
+    /* The blitter thread lives as long as the window: after the first
+       time, it only has to be told the new sizes. */
+    if (windata->blitter) {
+        KMSDRM_BlitterResume(windata->blitter, dispdata->mode.hdisplay, dispdata->mode.vdisplay,
+                             window->w, window->h);
+        goto done;
+    }
+
     /* Create blitter thread */
     windata->blitter = SDL_calloc(1, sizeof(KMSDRM_Blitter));
     *windata->blitter = (KMSDRM_Blitter){
@@ -1082,10 +1725,14 @@ KMSDRM_CreateSurfaces(_THIS, SDL_Window * window)
 
     KMSDRM_BlitterInit(windata->blitter);
 
-    /* Wait until the thread is ready */
-    SDL_LockMutex(windata->blitter->mutex);
-    SDL_CondWait(windata->blitter->cond, windata->blitter->mutex);
-    SDL_UnlockMutex(windata->blitter->mutex);
+done:
+    /* Clones show whatever goes to the window's display: the app's buffers
+       or the blitter's screen-sized ones. */
+    if (windata->plane_scaling) {
+        KMSDRM_SetupClones(_this, window, window->w, window->h);
+    } else {
+        KMSDRM_SetupClones(_this, window, dispdata->mode.hdisplay, dispdata->mode.vdisplay);
+    }
 
     SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, window->w, window->h);
 
@@ -1104,6 +1751,46 @@ cleanup:
     return ret;
 }
 
+/* Pick the modes again for the new content rate. Windows that aren't
+   fullscreen get theirs from KMSDRM_GetModeToSet() on surface recreation. */
+static void SDLCALL
+KMSDRM_ContentRateChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_VideoDevice *_this = (SDL_VideoDevice *)userdata;
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    float content_rate = hint ? (float)SDL_atof(hint) : 0.0f;
+    int i;
+
+    if (content_rate < 0.0f) {
+        content_rate = 0.0f;
+    }
+
+    if (content_rate == viddata->content_rate) {
+        return;
+    }
+
+    viddata->content_rate = content_rate;
+
+    for (i = 0; i < viddata->num_windows; i++) {
+        SDL_Window *window = viddata->windows[i];
+        SDL_VideoDisplay *display = SDL_GetDisplayForWindow(window);
+        SDL_DisplayData *dispdata = (SDL_DisplayData *)display->driverdata;
+        drmModeModeInfo *mode;
+
+        if (viddata->vulkan_mode) {
+            break;
+        }
+
+        mode = KMSDRM_GetClosestDisplayMode(display,
+                 window->windowed.w, window->windowed.h, viddata->content_rate);
+        if (mode) {
+            dispdata->fullscreen_mode = *mode;
+        }
+
+        KMSDRM_DirtySurfaces(window, viddata->rotation);
+    }
+}
+
 int
 KMSDRM_VideoInit(_THIS)
 {
@@ -1129,6 +1816,16 @@ KMSDRM_VideoInit(_THIS)
     SDL_WSCONS_Init();
 #endif
 
+    viddata->drm_event_lock = SDL_CreateMutex();
+    viddata->drm_event_cond = SDL_CreateCond();
+    viddata->drm_event_reader = SDL_FALSE;
+    if (!viddata->drm_event_lock || !viddata->drm_event_cond) {
+        ret = SDL_OutOfMemory();
+    }
+
+    viddata->content_rate = 0.0f;
+    SDL_AddHintCallback(SDL_HINT_KMSDRM_CONTENT_RATE, KMSDRM_ContentRateChanged, _this);
+
     viddata->video_init = SDL_TRUE;
 
     return ret;
@@ -1141,7 +1838,10 @@ KMSDRM_VideoQuit(_THIS)
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
 
+    SDL_DelHintCallback(SDL_HINT_KMSDRM_CONTENT_RATE, KMSDRM_ContentRateChanged, _this);
+
     KMSDRM_DeinitDisplays(_this);
+    KMSDRM_CloseIdleFD(_this);
 
 #ifdef SDL_INPUT_LINUXEV
     SDL_EVDEV_Quit();
@@ -1149,6 +1849,15 @@ KMSDRM_VideoQuit(_THIS)
     SDL_WSCONS_Quit();
 #endif
 
+    if (viddata->drm_event_cond) {
+        SDL_DestroyCond(viddata->drm_event_cond);
+        viddata->drm_event_cond = NULL;
+    }
+    if (viddata->drm_event_lock) {
+        SDL_DestroyMutex(viddata->drm_event_lock);
+        viddata->drm_event_lock = NULL;
+    }
+
     /* Clear out the window list */
     SDL_free(viddata->windows);
     viddata->windows = NULL;
@@ -1244,6 +1953,16 @@ KMSDRM_DestroyWindow(_THIS, SDL_Window *window)
         /* Destroy cursor GBM BO of the display of this window. */
         KMSDRM_DestroyCursorBO(_this, SDL_GetDisplayForWindow(window));
 
+        /* Normally gone already, SDL_DestroyWindow() destroys it first. */
+        KMSDRM_DestroyWindowFramebuffer(_this, window);
+
+        /* The blitter thread goes first, it may still hold the app's buffers. */
+        if (windata->blitter) {
+            KMSDRM_BlitterQuit(windata->blitter);
+            SDL_free(windata->blitter);
+            windata->blitter = NULL;
+        }
+
         /* Destroy GBM surface and buffers. */
         KMSDRM_DestroySurfaces(_this, window);
 
@@ -1309,6 +2028,8 @@ KMSDRM_CreateWindow(_THIS, SDL_Window * window)
     SDL_DisplayData *dispdata = display->driverdata;
     SDL_bool is_vulkan = window->flags & SDL_WINDOW_VULKAN; /* Is this a VK window? */
     SDL_bool vulkan_mode = viddata->vulkan_mode; /* Do we have any Vulkan windows? */
+    SDL_bool is_gl = window->flags & SDL_WINDOW_OPENGL; /* Did the app ask for GL? */
+    SDL_bool have_gl = SDL_TRUE;
     NativeDisplayType egl_display;
     drmModeModeInfo *mode;
     int ret = 0;
@@ -1321,6 +2042,7 @@ KMSDRM_CreateWindow(_THIS, SDL_Window * window)
 
     /* Setup driver data for this window */
     windata->viddata = viddata;
+    windata->window = window;
     window->driverdata = windata;
 
     if (!is_vulkan && !vulkan_mode) { /* NON-Vulkan block. */
@@ -1360,11 +2082,32 @@ KMSDRM_CreateWindow(_THIS, SDL_Window * window)
 	if (!_this->egl_data) {
 	    egl_display = (NativeDisplayType)((SDL_VideoData *)_this->driverdata)->gbm_dev;
 	    if (SDL_EGL_LoadLibrary(_this, NULL, egl_display, EGL_PLATFORM_GBM_MESA)) {
-                return (SDL_SetError("Can't load EGL/GL library on window creation."));
-	    }
+                /* Without a GPU, windows that didn't ask for GL can still
+                   be drawn with SDL_GetWindowSurface(), on dumb buffers. */
+                if (is_gl) {
+                    return (SDL_SetError("Can't load EGL/GL library on window creation."));
+                }
 
-	    _this->gl_config.driver_loaded = 1;
+                SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "No EGL, window will only have a framebuffer");
+                window->flags &= ~SDL_WINDOW_OPENGL;
+                have_gl = SDL_FALSE;
+	    } else {
+	        _this->gl_config.driver_loaded = 1;
+
+                if (SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_KHR_swap_buffers_with_damage")) {
+                    viddata->eglSwapBuffersWithDamage = SDL_EGL_GetProcAddress(_this, "eglSwapBuffersWithDamageKHR");
+                } else if (SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_EXT_swap_buffers_with_damage")) {
+                    viddata->eglSwapBuffersWithDamage = SDL_EGL_GetProcAddress(_this, "eglSwapBuffersWithDamageEXT");
+                } else {
+                    viddata->eglSwapBuffersWithDamage = NULL;
+                }
 
+                viddata->explicit_sync =
+                    SDL_GetHintBoolean(SDL_HINT_KMSDRM_EXPLICIT_SYNC, SDL_TRUE) &&
+                    _this->egl_data->eglDupNativeFenceFDANDROID && _this->egl_data->eglWaitSyncKHR &&
+                    SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_ANDROID_native_fence_sync") &&
+                    SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_KHR_wait_sync");
+	    }
 	}
 
 	/* Create the cursor BO for the display of this window,
@@ -1381,7 +2124,7 @@ KMSDRM_CreateWindow(_THIS, SDL_Window * window)
            If a window is fullscreen, SDL internals will call
            KMSDRM_SetWindowFullscreen() to reconfigure it if necessary. */
         mode = KMSDRM_GetClosestDisplayMode(display,
-                 window->windowed.w, window->windowed.h, 0 );
+                 window->windowed.w, window->windowed.h, viddata->content_rate);
 
         if (mode) {
             dispdata->fullscreen_mode = *mode;
@@ -1389,9 +2132,11 @@ KMSDRM_CreateWindow(_THIS, SDL_Window * window)
             dispdata->fullscreen_mode = dispdata->original_mode;
         }
 
+        windata->scanout_format = KMSDRM_GetScanoutFormat();
+
         /* Create the window surfaces with the size we have just chosen.
            Needs the window diverdata in place. */
-        if ((ret = KMSDRM_CreateSurfaces(_this, window))) {
+        if (have_gl && (ret = KMSDRM_CreateSurfaces(_this, window))) {
             return (SDL_SetError("Can't window GBM/EGL surfaces on window creation."));
         }
     } /* NON-Vulkan block ends. */
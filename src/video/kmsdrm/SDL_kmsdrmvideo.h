@@ -25,6 +25,9 @@
 #define __SDL_KMSDRMVIDEO_H__
 
 #include "../SDL_sysvideo.h"
+#include "SDL_mutex.h"
+#include "SDL_kmsdrmtiming.h"
+#include "SDL_kmsdrmcapture.h"
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -37,6 +40,7 @@ typedef struct SDL_VideoData
 {
     int devindex;               /* device index that was passed on creation */
     int drm_fd;                 /* DRM file desc */
+    int idle_drm_fd;            /* Kept from VideoInit() until GBM or Vulkan needs the device */
     char devpath[32];           /* DRM dev path. */
 
     struct gbm_device *gbm_dev;
@@ -49,6 +53,20 @@ typedef struct SDL_VideoData
     int max_windows;
     int num_windows;
     int rotation;
+    float content_rate;         /* SDL_HINT_KMSDRM_CONTENT_RATE, 0 if unset */
+
+    /* EGL_KHR_swap_buffers_with_damage or the EXT one, NULL if neither */
+    EGLBoolean (EGLAPIENTRY *eglSwapBuffersWithDamage)(EGLDisplay, EGLSurface, const EGLint *, EGLint);
+
+    /* GPU waits and native fence FDs instead of CPU waits, see SDL_HINT_KMSDRM_EXPLICIT_SYNC */
+    SDL_bool explicit_sync;
+
+    /* DRM events are read by whichever thread gets to the FD first, the event
+       pump or one waiting for its flip, see KMSDRM_WaitPageflip(). */
+    SDL_mutex *drm_event_lock;
+    SDL_cond *drm_event_cond;
+    SDL_bool drm_event_reader;  /* Is a thread blocked reading the FD? */
+    int wakeup_fd;              /* eventfd for SDL_WaitEventTimeout() wakeups */
 
     /* Even if we have several displays, we only have to
        open 1 FD and create 1 gbm device. */
@@ -57,6 +75,16 @@ typedef struct SDL_VideoData
 } SDL_VideoData;
 
 
+/* A DRM object (CRTC, connector or plane) with its properties, cached so
+   atomic requests can be built by property name without extra ioctls. */
+typedef struct KMSDRM_ObjectProps
+{
+    uint32_t obj_id;
+    uint32_t obj_type;
+    drmModeObjectProperties *props;
+    drmModePropertyRes **props_info;
+} KMSDRM_ObjectProps;
+
 typedef struct SDL_DisplayModeData
 {
     int mode_index;
@@ -72,21 +100,76 @@ typedef struct SDL_DisplayData
     drmModeModeInfo fullscreen_mode;
 
     drmModeCrtc *saved_crtc;    /* CRTC to restore on quit */
+    int crtc_index;             /* Index of the CRTC in the DRM resources, for possible_crtcs */
+
+    /* Atomic modesetting state, see SDL_kmsdrmatomic.c.
+       The pending request accumulates property changes (cursor plane, CRTC
+       properties...) that are merged into the next frame commit, so that
+       everything lands in the same vblank. */
+    SDL_bool atomic;            /* Is this display driven with atomic commits? */
+    SDL_bool atomic_tested;     /* Has the TEST_ONLY probe passed? */
+    KMSDRM_ObjectProps crtc_props;
+    KMSDRM_ObjectProps connector_props;
+    KMSDRM_ObjectProps plane_props;         /* Primary plane */
+    KMSDRM_ObjectProps cursor_plane_props;  /* Cursor plane, if any */
+    drmModeModeInfo atomic_mode;            /* Mode currently programmed on the CRTC */
+    uint32_t mode_blob_id;
+    drmModeAtomicReq *atomic_pending;
+    SDL_mutex *atomic_lock;
+    Uint32 atomic_last_commit;              /* SDL_GetTicks() of the last frame commit */
 
-    /* DRM & GBM cursor stuff lives here, not in an SDL_Cursor's driverdata struct,
-       because setting/unsetting up these is done on window creation/destruction,
-       where we may not have an SDL_Cursor at all (so no SDL_Cursor driverdata).
-       There's only one cursor GBM BO because we only support one cursor. */
-    struct gbm_bo *cursor_bo;
+    /* XRGB8888 modifiers the primary plane can scan out, from IN_FORMATS.
+       Empty if unknown or linear only, then allocations use implicit ones. */
+    uint64_t *modifiers;
+    int num_modifiers;
+
+    /* Variable refresh rate, enabled on the CRTC when the connector is capable.
+       Pending while VRR_ENABLED waits in atomic_pending for the first commit. */
+    SDL_bool vrr_enabled;
+    SDL_bool vrr_pending;
+    uint32_t vrr_prop_id;                   /* CRTC VRR_ENABLED property */
+
+    /* Blobs set on the CRTC DEGAMMA_LUT, CTM and GAMMA_LUT properties,
+       0 for a bypassed stage. See SDL_KMSDRMSetColorPipeline(). */
+    uint32_t color_blob_ids[3];
+
+    /* Each cursor has its own GBM BO (see KMSDRM_CursorData), the display only
+       knows the hardware cursor size, set up on window creation, and which BO
+       is on screen. cursor_bo_drm_fd is -1 until the display can show cursors. */
+    struct gbm_bo *cursor_bo;   /* Cursor BO on screen, NULL if hidden */
     int cursor_bo_drm_fd;
     uint64_t cursor_w, cursor_h;
 
     SDL_bool default_cursor_init;
 } SDL_DisplayData;
 
+/* What changed in a frame, see SDL_KMSDRMSetSwapDamage(). Rects that
+   don't fit are merged into the last one. */
+#define KMSDRM_MAX_DAMAGE_RECTS 16
+
+/* Most displays a window can be mirrored on, see SDL_HINT_KMSDRM_CLONE */
+#define KMSDRM_MAX_CLONES 3
+
+/* Page flips kept for SDL_SYSWMEVENT until the next KMSDRM_PumpEvents() */
+#define KMSDRM_MAX_FLIP_EVENTS 8
+
+typedef struct KMSDRM_FlipEvent
+{
+    Uint32 sequence;
+    Uint64 flip_ns;
+} KMSDRM_FlipEvent;
+
+typedef struct KMSDRM_Damage
+{
+    SDL_bool partial;           /* If not set, the whole frame changed */
+    int num_rects;              /* 0 with partial set: nothing changed */
+    SDL_Rect rects[KMSDRM_MAX_DAMAGE_RECTS];
+} KMSDRM_Damage;
+
 typedef struct SDL_WindowData
 {
     SDL_VideoData *viddata;
+    SDL_Window *window;
     /* SDL internals expect EGL surface to be here, and in KMSDRM the GBM surface is
        what supports the EGL surface on the driver side, so all these surfaces and buffers
        are expected to be here, in the struct pointed by SDL_Window driverdata pointer:
@@ -95,25 +178,63 @@ typedef struct SDL_WindowData
     struct gbm_bo *bo;
     struct gbm_bo *next_bo;
     struct KMSDRM_Blitter *blitter;
+    uint32_t scanout_format;    /* SDL_HINT_KMSDRM_SCANOUT_FORMAT, as a GBM fourcc */
+
+    /* Direct scanout: the app's BOs go straight to the primary plane, which
+       scales them into plane_rect, instead of through the blitter. */
+    SDL_bool plane_scaling;
+    SDL_Rect plane_rect;
+    uint64_t plane_rotation;
+
+    /* Clone mode: other displays showing the same frames from their own
+       primary plane, in the same commits. */
+    SDL_DisplayData *clones[KMSDRM_MAX_CLONES];
+    int num_clones;
 
     SDL_bool waiting_for_flip;
+    int flips_pending;          /* Flip events (one per CRTC) still to come */
     SDL_bool double_buffer;
 
+    KMSDRM_FrameTimes timing;   /* Presentation timing, see SDL_kmsdrmtiming.c */
+    KMSDRM_Capture capture;     /* Frames kept for capture, see SDL_kmsdrmcapture.c */
+
+    /* Flips not sent as SDL_SYSWMEVENT yet, under drm_event_lock */
+    KMSDRM_FlipEvent flip_events[KMSDRM_MAX_FLIP_EVENTS];
+    int num_flip_events;
+
+    KMSDRM_Damage damage;       /* For the next swap only */
+    SDL_bool presented;         /* Has a frame of the current surfaces been shown? */
+
+    struct KMSDRM_Framebuffer *framebuffer; /* SDL_GetWindowSurface(), see SDL_kmsdrmframebuffer.c */
+
     EGLSurface egl_surface;
     SDL_bool egl_surface_dirty;
 } SDL_WindowData;
 
+/* Per-BO data, attached with gbm_bo_set_user_data() and freed with the BO */
 typedef struct KMSDRM_FBInfo
 {
     int drm_fd;         /* DRM file desc */
-    uint32_t fb_id;     /* DRM framebuffer ID */
+    uint32_t fb_id;     /* DRM framebuffer ID, 0 until one is needed */
+    struct KMSDRM_Blitter *blitter; /* Blitter that has the BO imported, if any */
+    int import_slot;    /* Where, in the blitter's imports[] */
 } KMSDRM_FBInfo;
 
 /* Helper functions */
 int KMSDRM_CreateSurfaces(_THIS, SDL_Window * window);
+KMSDRM_FBInfo *KMSDRM_GetBOInfo(_THIS, struct gbm_bo *bo);
 KMSDRM_FBInfo *KMSDRM_FBFromBO(_THIS, struct gbm_bo *bo);
-KMSDRM_FBInfo *KMSDRM_FBFromBO2(_THIS, struct gbm_bo *bo, int w, int h);
+KMSDRM_FBInfo *KMSDRM_FBFromBOFormat(_THIS, struct gbm_bo *bo, uint32_t format);
 SDL_bool KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata);
+void KMSDRM_DispatchDRMEvents(_THIS);
+void KMSDRM_SendFlipEvents(_THIS);
+void KMSDRM_CloseIdleFD(_THIS);
+void KMSDRM_GetModeToSet(SDL_Window *window, drmModeModeInfo *out_mode, int rotation);
+struct gbm_surface *KMSDRM_CreateGBMSurface(_THIS, SDL_DisplayData *dispdata,
+                                            uint32_t width, uint32_t height,
+                                            uint32_t format, uint32_t flags);
+void KMSDRM_AddDamage(KMSDRM_Damage *damage, const SDL_Rect *rect, int width, int height);
+void KMSDRM_MergeDamage(KMSDRM_Damage *damage, const KMSDRM_Damage *other);
 
 /****************************************************************************/
 /* SDL_VideoDevice functions declaration                                    */
@@ -141,6 +262,17 @@ void KMSDRM_MinimizeWindow(_THIS, SDL_Window * window);
 void KMSDRM_RestoreWindow(_THIS, SDL_Window * window);
 void KMSDRM_DestroyWindow(_THIS, SDL_Window * window);
 
+#ifdef __LINUX__
+int KMSDRM_GetFrameTimings(_THIS, SDL_Window * window, SDL_KMSDRMFrameTiming *timings, int count);
+int KMSDRM_SetSwapDamage(_THIS, SDL_Window * window, const SDL_Rect * rects, int count);
+int KMSDRM_GetColorPipeline(_THIS, SDL_Window * window, int *degamma_size, SDL_bool *has_ctm, int *gamma_size);
+int KMSDRM_SetColorPipeline(_THIS, SDL_Window * window, const SDL_KMSDRMColorLUTEntry *degamma,
+                            const float *ctm, const SDL_KMSDRMColorLUTEntry *gamma);
+int KMSDRM_SetCaptureFrames(_THIS, SDL_Window * window, int count);
+int KMSDRM_AcquireCaptureFrame(_THIS, SDL_Window * window, SDL_KMSDRMCaptureFrame * frame);
+int KMSDRM_ReleaseCaptureFrame(_THIS, SDL_Window * window, const SDL_KMSDRMCaptureFrame * frame);
+#endif
+
 /* Window manager function */
 SDL_bool KMSDRM_GetWindowWMInfo(_THIS, SDL_Window * window,
                              struct SDL_SysWMinfo *info);
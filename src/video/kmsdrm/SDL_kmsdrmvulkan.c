@@ -54,6 +54,9 @@ int KMSDRM_Vulkan_LoadLibrary(_THIS, const char *path)
     if(_this->vulkan_config.loader_handle)
         return SDL_SetError("Vulkan already loaded");
 
+    /* The FD VideoInit() kept would be in the way of the display extension */
+    KMSDRM_CloseIdleFD(_this);
+
     /* Load the Vulkan library */
     if(!path)
         path = SDL_getenv("SDL_VULKAN_LIBRARY");
@@ -40,15 +40,6 @@ my @dst_formats = (
     "ARGB8888",
 );
 
-my %format_size = (
-    "RGB888" => 4,
-    "BGR888" => 4,
-    "ARGB8888" => 4,
-    "RGBA8888" => 4,
-    "ABGR8888" => 4,
-    "BGRA8888" => 4,
-);
-
 my %format_type = (
     "RGB888" => "Uint32",
     "BGR888" => "Uint32",
@@ -58,6 +49,23 @@ my %format_type = (
     "BGRA8888" => "Uint32",
 );
 
+# Channel shifts (red, green, blue, alpha) for the SIMD kernels in SDL_blit_auto_simd.h
+my %format_shifts = (
+    "RGB888" => "16, 8, 0, -1",
+    "BGR888" => "0, 8, 16, -1",
+    "ARGB8888" => "16, 8, 0, 24",
+    "RGBA8888" => "24, 16, 8, 0",
+    "ABGR8888" => "0, 8, 16, 24",
+    "BGRA8888" => "8, 16, 24, 0",
+);
+
+# The SIMD blitters: suffix, guard and CPU feature, in order of preference
+my @simd_variants = (
+    [ "AVX2", "SDL_BLIT_HAVE_AVX2", "SDL_CPU_AVX2" ],
+    [ "SSE2", "SDL_BLIT_HAVE_SSE2", "SDL_CPU_SSE2" ],
+    [ "NEON", "SDL_BLIT_HAVE_NEON", "SDL_CPU_NEON" ],
+);
+
 my %get_rgba_string_ignore_alpha = (
     "RGB888" => "_R = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _B = (Uint8)_pixel;",
     "BGR888" => "_B = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _R = (Uint8)_pixel;",
@@ -153,6 +161,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $simd = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -164,6 +173,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $simd ) {
+        print FILE "_$simd";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -529,7 +541,6 @@ __EOF__
     }
     if ( $scale ) {
         print FILE <<__EOF__;
-    int srcy, srcx;
     Uint32 posy, posx;
     int incy, incx;
 __EOF__
@@ -541,15 +552,14 @@ __EOF__
     posy = incy / 2;
 
     while (info->dst_h--) {
+        $format_type{$src} *srcrow = ($format_type{$src} *)(info->src + (posy >> 16) * info->src_pitch);
         $format_type{$src} *src = 0;
         $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
         int n = info->dst_w;
         posx = incx / 2;
 
-        srcy = posy >> 16;
         while (n--) {
-            srcx = posx >> 16;
-            src = ($format_type{$src} *)(info->src + (srcy * info->src_pitch) + (srcx * $format_size{$src}));
+            src = srcrow + (posx >> 16);
 __EOF__
         print FILE <<__EOF__;
 __EOF__
@@ -597,15 +607,16 @@ sub output_copyinc
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "SDL_blit_auto_simd.h"
 
 __EOF__
 }
 
-sub output_copyfunctable
+sub output_copyfunctable_entries
 {
-    print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
-__EOF__
+    my $simd = shift;
+    my $cpu = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -613,7 +624,7 @@ __EOF__
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
-                        if ( $modulate || $blend || $scale ) {
+                        if ( $simd ? has_simdfunc($src, $dst, $modulate, $blend, $scale) : ($modulate || $blend || $scale) ) {
                             print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
@@ -626,7 +637,12 @@ __EOF__
                                 }
                             }
                             if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
+                                # The SIMD kernels leave SDL_COPY_MUL to the C blitters
+                                if ( $simd ) {
+                                    $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
+                                } else {
+                                    $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
+                                }
                                 if ( $flags eq "" ) {
                                     $flags = $flag;
                                 } else {
@@ -644,14 +660,29 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $simd);
                         }
                     }
                 }
             }
         }
     }
+}
+
+sub output_copyfunctable
+{
+    print FILE <<__EOF__;
+SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+__EOF__
+    # SDL_ChooseBlitFunc() takes the first match, so the SIMD blitters go first
+    foreach my $variant (@simd_variants) {
+        my ($simd, $guard, $cpu) = @$variant;
+        print FILE "#if $guard\n";
+        output_copyfunctable_entries($simd, $cpu);
+        print FILE "#endif\n";
+    }
+    output_copyfunctable_entries("", "SDL_CPU_ANY");
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
 };
@@ -659,6 +690,67 @@ __EOF__
 __EOF__
 }
 
+# A plain scaled copy between identical formats has nothing to vectorize
+sub has_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    if ( !$modulate && !$blend ) {
+        return $scale && $src ne $dst;
+    }
+    return 1;
+}
+
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $simd = shift;
+    my $prefix = "static void";
+
+    if ( $simd eq "AVX2" ) {
+        $prefix = "static void SDL_TARGETING_AVX2";
+    }
+    output_copyfuncname($prefix, $src, $dst, $modulate, $blend, $scale, 1, "\n", $simd);
+    print FILE <<__EOF__;
+{
+    const SDL_Blit8888Format srcfmt = { $format_shifts{$src} };
+    const SDL_Blit8888Format dstfmt = { $format_shifts{$dst} };
+    SDL_Blit8888_$simd(info, &srcfmt, &dstfmt, $modulate, $blend, $scale);
+}
+
+__EOF__
+}
+
+sub output_simdfuncs
+{
+    foreach my $variant (@simd_variants) {
+        my ($simd, $guard, $cpu) = @$variant;
+        print FILE "#if $guard\n\n";
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( has_simdfunc($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale) ) {
+                                output_simdfunc($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, $simd);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $guard */\n\n";
+    }
+}
+
 sub output_copyfunc_c
 {
     my $src = shift;
@@ -692,5 +784,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -399,6 +399,139 @@ pixels_allocFreePalette(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Reference for SDL_MapRGBA on a palette: closest color, lowest index on ties */
+static Uint32
+_findColor(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+  Uint32 smallest = 0xFFFFFFFF;
+  Uint32 pixel = 0;
+  int i;
+
+  for (i = 0; i < palette->ncolors; i++) {
+    const int rd = palette->colors[i].r - r;
+    const int gd = palette->colors[i].g - g;
+    const int bd = palette->colors[i].b - b;
+    const int ad = palette->colors[i].a - a;
+    const Uint32 distance = (Uint32)(rd * rd + gd * gd + bd * bd + ad * ad);
+    if (distance < smallest) {
+      smallest = distance;
+      pixel = i;
+    }
+  }
+  return pixel;
+}
+
+/**
+ * @brief Call to SDL_MapRGB and SDL_MapRGBA on palettized formats
+ *
+ * @sa http://wiki.libsdl.org/SDL_MapRGB
+ * @sa http://wiki.libsdl.org/SDL_MapRGBA
+ */
+int
+pixels_mapRGBPalette(void *arg)
+{
+  SDL_PixelFormat *format;
+  SDL_Palette *palette;
+  SDL_Color colors[256];
+  int variation;
+  int i;
+  int ncolors;
+  int mismatches;
+  Uint8 r, g, b, a;
+  Uint32 expected, result;
+
+  format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+  SDLTest_AssertPass("Call to SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8)");
+  SDLTest_AssertCheck(format != NULL, "Verify result is not NULL");
+  if (format == NULL) {
+    return TEST_ABORTED;
+  }
+
+  for (variation = 1; variation <= 4; variation++) {
+    switch (variation) {
+      /* Small palette */
+      case 1:
+        ncolors = SDLTest_RandomIntegerInRange(2, 16);
+        break;
+      /* Large palette */
+      case 2:
+        ncolors = 256;
+        break;
+      /* Large palette with duplicate colors */
+      case 3:
+        ncolors = 256;
+        break;
+      /* Large palette with translucent colors */
+      case 4:
+        ncolors = SDLTest_RandomIntegerInRange(32, 256);
+        break;
+    }
+
+    for (i = 0; i < ncolors; i++) {
+      colors[i].r = SDLTest_RandomUint8();
+      colors[i].g = SDLTest_RandomUint8();
+      colors[i].b = SDLTest_RandomUint8();
+      colors[i].a = (variation == 4) ? SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+      if (variation == 3) {
+        colors[i].r &= 0xC0;
+        colors[i].g &= 0xC0;
+        colors[i].b &= 0x80;
+      }
+    }
+
+    palette = SDL_AllocPalette(ncolors);
+    SDLTest_AssertPass("Call to SDL_AllocPalette(%d)", ncolors);
+    SDLTest_AssertCheck(palette != NULL, "Verify result is not NULL");
+    if (palette == NULL) {
+      continue;
+    }
+    SDL_SetPaletteColors(palette, colors, 0, ncolors);
+    SDL_SetPixelFormatPalette(format, palette);
+
+    /* Random colors, and the palette colors themselves */
+    mismatches = 0;
+    for (i = 0; i < 10000; i++) {
+      if (i < ncolors) {
+        r = colors[i].r;
+        g = colors[i].g;
+        b = colors[i].b;
+      } else {
+        r = SDLTest_RandomUint8();
+        g = SDLTest_RandomUint8();
+        b = SDLTest_RandomUint8();
+      }
+      a = (i & 1) ? SDL_ALPHA_OPAQUE : SDLTest_RandomUint8();
+      expected = _findColor(palette, r, g, b, a);
+      result = SDL_MapRGBA(format, r, g, b, a);
+      if (result != expected) {
+        mismatches++;
+      }
+    }
+    SDLTest_AssertPass("Call to SDL_MapRGBA() with %d colors", ncolors);
+    SDLTest_AssertCheck(mismatches == 0, "Verify mapped colors; expected: 0 mismatches, got %d", mismatches);
+
+    /* Changing the colors updates the mapping */
+    colors[0].r = 0;
+    colors[0].g = 0;
+    colors[0].b = 0;
+    colors[0].a = SDL_ALPHA_OPAQUE;
+    SDL_SetPaletteColors(palette, colors, 0, 1);
+    result = SDL_MapRGB(format, 0, 0, 0);
+    expected = _findColor(palette, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDLTest_AssertPass("Call to SDL_MapRGB() after SDL_SetPaletteColors()");
+    SDLTest_AssertCheck(result == expected, "Verify mapped color; expected: %u, got %u", expected, result);
+
+    SDL_SetPixelFormatPalette(format, NULL);
+    SDL_FreePalette(palette);
+    SDLTest_AssertPass("Call to SDL_FreePalette()");
+  }
+
+  SDL_FreeFormat(format);
+  SDLTest_AssertPass("Call to SDL_FreeFormat()");
+
+  return TEST_COMPLETED;
+}
+
 /**
  * @brief Call to SDL_CalculateGammaRamp
  *
@@ -517,9 +650,12 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_mapRGBPalette, "pixels_mapRGBPalette", "Call to SDL_MapRGB and SDL_MapRGBA on palettized formats", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, NULL
 };
 
 /* Pixels test suite (global) */
@@ -764,6 +764,147 @@ surface_testOverflow(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Number of surfaces produced by _runBandedOperations() */
+#define BANDED_BLIT_FORMATS 4
+#define BANDED_BLIT_MODES   4
+#define BANDED_BLIT_RECTS   3
+#define BANDED_RESULTS      (BANDED_BLIT_FORMATS * BANDED_BLIT_MODES * BANDED_BLIT_RECTS + 5)
+
+/**
+ * Helper that blits, converts and premultiplies the given surface, with
+ * SDL_HINT_SURFACE_THREAD_THRESHOLD set to the given value. The results go
+ * into new surfaces, which the caller frees.
+ */
+void _runBandedOperations(SDL_Surface *src, const char *threshold, SDL_Surface **results)
+{
+    const Uint32 formats[BANDED_BLIT_FORMATS] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24
+    };
+    const SDL_BlendMode modes[BANDED_BLIT_MODES] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+    };
+    /* Odd heights, and destinations hanging off each edge */
+    const SDL_Rect rects[BANDED_BLIT_RECTS] = {
+        { 3, 2, 0, 0 }, { -7, -5, 0, 0 }, { 61, 40, 0, 0 }
+    };
+    const int dst_w = 113, dst_h = 71;
+    SDL_Surface *dst;
+    SDL_Rect rect;
+    int f, m, r, ret, n = 0;
+
+    SDL_SetHint(SDL_HINT_SURFACE_THREAD_THRESHOLD, threshold);
+    SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_SURFACE_THREAD_THRESHOLD, \"%s\")", threshold);
+
+    for (f = 0; f < BANDED_BLIT_FORMATS; f++) {
+        for (m = 0; m < BANDED_BLIT_MODES; m++) {
+            for (r = 0; r < BANDED_BLIT_RECTS; r++) {
+                dst = SDL_CreateRGBSurfaceWithFormat(0, dst_w, dst_h, 0, formats[f]);
+                SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+                results[n++] = dst;
+                if (dst == NULL) continue;
+
+                ret = SDL_FillRect(dst, NULL, SDL_MapRGBA(dst->format, 40, 90, 160, 128));
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect, expected: 0, got: %i", ret);
+
+                /* Surface alpha on the last rect, so both alpha blitters run */
+                SDL_SetSurfaceBlendMode(src, modes[m]);
+                SDL_SetSurfaceAlphaMod(src, (r == BANDED_BLIT_RECTS - 1) ? 170 : 255);
+                if (r == BANDED_BLIT_RECTS - 1) {
+                    /* An odd clip rectangle as well */
+                    rect.x = 5;
+                    rect.y = 7;
+                    rect.w = dst_w - 12;
+                    rect.h = dst_h - 18;
+                    SDL_SetClipRect(dst, &rect);
+                }
+                rect = rects[r];
+                ret = SDL_BlitSurface(src, NULL, dst, &rect);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+            }
+        }
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, 255);
+
+    /* Conversions, including a same format copy */
+    for (f = 0; f < BANDED_BLIT_FORMATS; f++) {
+        dst = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 0, formats[f]);
+        SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+        results[n++] = dst;
+        if (dst == NULL) continue;
+
+        ret = SDL_ConvertPixels(src->w, src->h, src->format->format, src->pixels, src->pitch,
+                                dst->format->format, dst->pixels, dst->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+    }
+
+    dst = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 0, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+    results[n++] = dst;
+    if (dst != NULL) {
+        ret = SDL_PremultiplyAlpha(src->w, src->h, src->format->format, src->pixels, src->pitch,
+                                   dst->format->format, dst->pixels, dst->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplyAlpha, expected: 0, got: %i", ret);
+    }
+
+    SDL_ResetHint(SDL_HINT_SURFACE_THREAD_THRESHOLD);
+}
+
+/**
+ * @brief Tests that blits, conversions and alpha premultiplication give
+ * the same results whether they are split across threads or not.
+ */
+int
+surface_testThreadedBands(void *arg)
+{
+    SDL_Surface *src;
+    SDL_Surface *threaded[BANDED_RESULTS];
+    SDL_Surface *single[BANDED_RESULTS];
+    Uint32 seed = 0x5eed;
+    int i, x, y, row_bytes, mismatches;
+
+    /* Sprite-like content, an odd height makes the bands uneven */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 97, 53, 0, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (src == NULL) return TEST_ABORTED;
+    for (y = 0; y < src->h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < src->w; x++) {
+            seed = seed * 1103515245 + 12345;
+            row[x] = seed >> 8;
+            switch (seed >> 30) {
+            case 0: row[x] &= 0x00ffffff; break;
+            case 1: row[x] |= 0xff000000; break;
+            default: row[x] |= seed << 24; break;
+            }
+        }
+    }
+
+    /* Every job is over the threshold, then none are threaded */
+    _runBandedOperations(src, "1", threaded);
+    _runBandedOperations(src, "0", single);
+
+    for (i = 0; i < BANDED_RESULTS; i++) {
+        if (threaded[i] == NULL || single[i] == NULL) continue;
+
+        mismatches = 0;
+        row_bytes = threaded[i]->w * threaded[i]->format->BytesPerPixel;
+        for (y = 0; y < threaded[i]->h; y++) {
+            if (SDL_memcmp((Uint8 *)threaded[i]->pixels + y * threaded[i]->pitch,
+                           (Uint8 *)single[i]->pixels + y * single[i]->pitch, row_bytes) != 0) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Validate threaded result %d, expected: 0 differing rows, got: %i", i, mismatches);
+
+        SDL_FreeSurface(threaded[i]);
+        SDL_FreeSurface(single[i]);
+    }
+    SDL_FreeSurface(src);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -809,11 +950,14 @@ static const SDLTest_TestCaseReference surfaceTest12 =
 static const SDLTest_TestCaseReference surfaceTestOverflow =
         { surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTestThreadedBands =
+        { surface_testThreadedBands, "surface_testThreadedBands", "Tests that threaded blits match single threaded ones.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestThreadedBands, NULL
 };
 
 /* Surface test suite (global) */
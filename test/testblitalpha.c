@@ -0,0 +1,159 @@
+/*
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the throughput of the alpha blended blitters, per format pair */
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    Uint32 src_format;
+    Uint32 dst_format;
+    int surface_alpha;          /* -1 for per-pixel alpha */
+} BlitCase;
+
+static const BlitCase cases[] = {
+    { "ARGB8888 -> ARGB8888, pixel alpha", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, -1 },
+    { "ARGB8888 -> RGB888, pixel alpha", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, -1 },
+    { "ABGR8888 -> ABGR8888, pixel alpha", SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, -1 },
+    { "ARGB8888 -> RGB565, pixel alpha", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, -1 },
+    { "RGB888 -> RGB888, surface alpha 200", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, 200 },
+    { "RGB888 -> ARGB8888, surface alpha 128", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, 128 },
+    { "RGB565 -> RGB565, surface alpha 200", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, 200 },
+};
+
+static Uint32 seed = 0x12345678;
+
+static Uint32
+random_u32(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+/* Sprite-like content: a mix of fully transparent, opaque and translucent pixels */
+static void
+fill_surface(SDL_Surface *surface)
+{
+    SDL_PixelFormat *fmt = surface->format;
+    int x, y;
+
+    for (y = 0; y < surface->h; y++) {
+        Uint8 *row = (Uint8 *) surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->w; x++) {
+            Uint32 rnd = random_u32();
+            Uint8 a;
+            Uint32 pixel;
+
+            switch (rnd % 4) {
+            case 0: a = SDL_ALPHA_TRANSPARENT; break;
+            case 1: a = SDL_ALPHA_OPAQUE; break;
+            default: a = (Uint8) (rnd >> 24); break;
+            }
+            pixel = SDL_MapRGBA(fmt, (Uint8) (rnd >> 8), (Uint8) (rnd >> 16), (Uint8) (rnd >> 2), a);
+            if (fmt->BytesPerPixel == 2) {
+                ((Uint16 *) row)[x] = (Uint16) pixel;
+            } else {
+                ((Uint32 *) row)[x] = pixel;
+            }
+        }
+    }
+}
+
+static SDL_bool
+run_case(const BlitCase *test, int w, int h, int iterations)
+{
+    SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, test->src_format);
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, test->dst_format);
+    Uint64 start, elapsed;
+    double seconds;
+    int i;
+
+    if (!src || !dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s", SDL_GetError());
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return SDL_FALSE;
+    }
+
+    fill_surface(src);
+    fill_surface(dst);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    if (test->surface_alpha >= 0) {
+        SDL_SetSurfaceAlphaMod(src, (Uint8) test->surface_alpha);
+    }
+
+    /* Warm up, this also maps the surfaces */
+    SDL_BlitSurface(src, NULL, dst, NULL);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    seconds = (double) elapsed / SDL_GetPerformanceFrequency();
+
+    SDL_Log("%-40s %8.2f ms/blit %10.1f Mpixels/s", test->name,
+            seconds * 1000.0 / iterations,
+            (double) w * h * iterations / seconds / 1000000.0);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return SDL_TRUE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int w = 1920, h = 1080, iterations = 100;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--size") == 0 && i + 2 < argc) {
+            w = SDL_atoi(argv[++i]);
+            h = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--size width height] [--iterations n]", argv[0]);
+            return 1;
+        }
+    }
+    if (w <= 0 || h <= 0 || iterations <= 0) {
+        SDL_Log("Invalid size or iteration count");
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%dx%d, %d blits per format. CPU: MMX %d, SSE2 %d, AVX2 %d, NEON %d",
+            w, h, iterations, SDL_HasMMX(), SDL_HasSSE2(), SDL_HasAVX2(), SDL_HasNEON());
+
+    for (i = 0; i < (int) SDL_arraysize(cases); i++) {
+        if (!run_case(&cases[i], w, h, iterations)) {
+            SDL_Quit();
+            return 1;
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */